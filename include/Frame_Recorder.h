@@ -0,0 +1,56 @@
+#pragma once
+#include <Arduino.h>
+
+/******************************************************************************
+  Black-box recorder for received serial lines
+
+  A fixed ring of the last RECORDER_FRAMES raw lines with receive time, boot
+  number and parse result, kept in RTC no-init memory so it survives soft
+  resets, panics and watchdog resets (it is cleared on power-on). Recording
+  is a single memcpy into the next slot.
+
+  The "DUMP" command streams the ring oldest first, each line diff-encoded
+  against the previous one:
+    DUMP:<boot>,<count>,<now_ms>
+    BOOT:<boot>                          when the boot number changes
+    D:<dt_ms>,<result>,<fields>,<mask_hex>|<changed fields>
+    DUMP:END
+  Lines are split at commas; bit i of the mask means field i equals field i
+  of the previous line, and only the other fields are sent. dt_ms is the
+  time since the previous line of the same boot (absolute after BOOT:).
+******************************************************************************/
+
+#define RECORDER_FRAMES     32
+#define RECORDER_FRAME_LEN  128     // Matches SERIAL_BUFFER_SIZE
+#define RECORDER_MAX_FIELDS 32      // Fields beyond this are always sent
+
+// Parse result recorded with every line
+enum FrameResult : uint8_t {
+  FRAME_OK = 0,
+  FRAME_BAD_CHECKSUM,
+  FRAME_MISSING_FIELD,
+  FRAME_OUT_OF_RANGE,
+  FRAME_BAD_DEFINITION,
+  FRAME_OVERFLOW,             // Line longer than the serial buffer, truncated
+};
+
+struct RecordedFrame {
+  uint32_t ms;                // millis() at receipt
+  uint16_t boot;
+  uint8_t  result;            // FrameResult
+  uint8_t  len;
+  char     data[RECORDER_FRAME_LEN];
+};
+
+struct FrameRecorder {
+  uint32_t magic;
+  uint16_t boot;              // Incremented on every start that kept the ring
+  uint16_t head;              // Next slot
+  uint16_t count;
+  RecordedFrame frames[RECORDER_FRAMES];
+};
+
+// Keep the ring across soft resets, or clear it after power-on / corruption
+void Recorder_Init(bool power_on);
+void Recorder_Push(const char *line, size_t len, FrameResult result);
+void Recorder_Dump(Print &out);
@@ -12,6 +12,10 @@
 
 #define EXAMPLE_LVGL_TICK_PERIOD_MS  5
 
+// Panel frame rate follows display activity
+#define PANEL_ACTIVE_REFRESHES  3     // LVGL refreshes per second that count as animation
+#define PANEL_ACTIVE_HOLD_MS    2000  // Keep the active rate this long after activity stops
+
 
 void Lvgl_print(const char * buf);
 void Lvgl_Display_LCD( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p ); // Displays LVGL content on the LCD.    This function implements associating LVGL data to the LCD screen
@@ -20,3 +24,4 @@ void example_increase_lvgl_tick(void *arg);
 
 void Lvgl_Init(void);
 void Timer_Loop(void);
+void Lvgl_Adapt_Frame_Rate(bool power_save);  // Call from the main loop
@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+
+/******************************************************************************
+  Multi-resolution metric history
+
+  Three tiers per metric, rolled up incrementally on every 1 s tick:
+    tier 0:  1 s samples     x 300   (5 minutes)
+    tier 1: 10 s min/max/avg x 360   (1 hour)
+    tier 2:  1 min min/max/avg x 1440 (24 hours)
+  Samples are uint8 fixed point in half units (0..127.5), 0xFF marks a tick
+  without data (disconnected). Each tier keeps a running accumulator for the
+  bucket in progress, so a push never rescans older samples.
+  Memory: 300 + 3 * (360 + 1440) = 5700 bytes per metric.
+******************************************************************************/
+
+#define HISTORY_NO_DATA      0xFF
+#define HISTORY_TIERS        3
+#define HISTORY_T0_LEN       300
+#define HISTORY_T1_LEN       360
+#define HISTORY_T2_LEN       1440
+#define HISTORY_T1_SECONDS   10
+#define HISTORY_T2_SECONDS   60
+
+struct HistoryBucket {
+  uint8_t min;
+  uint8_t max;
+  uint8_t avg;
+};
+
+// Bucket under construction for the next tier
+struct HistoryAccum {
+  uint8_t  min;
+  uint8_t  max;
+  uint16_t sum;
+  uint8_t  count;   // Ticks with data
+  uint8_t  ticks;   // Ticks seen, with or without data
+};
+
+struct MetricHistory {
+  uint8_t       t0[HISTORY_T0_LEN];
+  HistoryBucket t1[HISTORY_T1_LEN];
+  HistoryBucket t2[HISTORY_T2_LEN];
+  uint16_t      t0_head;
+  uint16_t      t1_head;
+  uint16_t      t2_head;
+  HistoryAccum  acc1;       // Tier 0 samples -> next tier 1 bucket
+  HistoryAccum  acc2;       // Tier 1 buckets -> next tier 2 bucket
+};
+
+// History page instances, defined in Metric_History.cpp (metrics footprint subsystem)
+extern MetricHistory cpuHistory;
+extern MetricHistory tempHistory;
+
+void History_Init(MetricHistory &h);
+void History_Push(MetricHistory &h, float value);
+void History_PushGap(MetricHistory &h);
+
+// Finest tier whose length covers span_s, and that tier's resolution
+uint8_t History_TierForSpan(uint32_t span_s);
+uint16_t History_TierSeconds(uint8_t tier);
+
+// Resample the last span_s seconds into `points` averages, oldest first (HISTORY_NO_DATA for gaps)
+void History_Read(const MetricHistory &h, uint32_t span_s, uint8_t *out, uint16_t points);
@@ -0,0 +1,52 @@
+#pragma once
+#include <Arduino.h>
+
+/******************************************************************************
+  Streaming per-metric statistics in constant memory
+
+  Values are pushed once per STATS_TICK_MS as fixed-point tenths. A ring of
+  the last STATS_WINDOW_S samples feeds a fixed-bucket histogram and a running
+  sum, so a push is O(1): add the new sample, evict the oldest. Percentiles
+  and window min/max are read from the histogram at bucket resolution (the
+  bucket midpoint, clamped to the session range), only when the stats page
+  is drawn. Session min/max are exact.
+******************************************************************************/
+
+#ifndef STATS_WINDOW_S
+#define STATS_WINDOW_S  300     // Window length in ticks (5 minutes at 1 Hz)
+#endif
+#define STATS_TICK_MS   1000
+#define STATS_BUCKETS   128
+
+struct MetricStats {
+  int16_t  lo_x10;                  // Lower edge of bucket 0, tenths
+  int16_t  bucket_x10;              // Bucket width, tenths
+  int16_t  ring[STATS_WINDOW_S];    // Window samples, tenths
+  uint16_t head;                    // Next ring slot
+  uint16_t count;                   // Samples in the window
+  int32_t  sum_x10;                 // Sum of window samples, tenths
+  uint16_t hist[STATS_BUCKETS];
+  int16_t  session_min_x10;
+  int16_t  session_max_x10;
+};
+
+struct StatsSummary {
+  uint16_t count;
+  float p50;
+  float p95;
+  float min;          // Window min/max at bucket resolution
+  float max;
+  float avg;
+  float session_min;
+  float session_max;
+};
+
+// Dashboard instances, indexed by ui_stats_row_t. Defined in Metric_Stats.cpp
+// so their RAM is reported under the metrics footprint subsystem.
+#define STATS_METRICS   4
+extern MetricStats metricStats[STATS_METRICS];
+
+void Stats_Init(MetricStats &s, float lo, float bucket_width);
+void Stats_Push(MetricStats &s, float value);
+float Stats_Percentile(const MetricStats &s, uint8_t pct);
+void Stats_Summarize(const MetricStats &s, StatsSummary &out);
@@ -0,0 +1,68 @@
+#pragma once
+#include "Panel_Driver.h"
+
+/******************************************************************************
+  Panel configurations, selected per PlatformIO environment:
+    (default)                 Waveshare ESP32-C6-LCD-1.47, ST7789 172x320
+    -DPANEL_ST7789_240X320    ST7789 2.0"/2.4" 240x320
+    -DPANEL_ILI9341_240X320   ILI9341 2.4"/2.8" 240x320
+  Geometry is native portrait; LVGL rotates to landscape in software.
+******************************************************************************/
+
+// ESP32-C6-LCD-1.47 wiring, also used for external panels on the same header
+struct C6DevkitPins {
+  static constexpr uint8_t miso = 5;
+  static constexpr uint8_t mosi = 6;
+  static constexpr uint8_t sclk = 7;
+  static constexpr uint8_t cs   = 14;
+  static constexpr uint8_t dc   = 15;
+  static constexpr uint8_t rst  = 21;
+  static constexpr uint8_t bl   = 22;
+};
+
+struct ST7789_172x320 {
+  using Controller = ST7789;
+  using Pins = C6DevkitPins;
+  static constexpr uint16_t width    = 172;
+  static constexpr uint16_t height   = 320;
+  static constexpr uint16_t offset_x = 34;   // 172 columns centred in the 240-column RAM
+  static constexpr uint16_t offset_y = 0;
+  static constexpr uint8_t  madctl   = 0x00;
+  static constexpr uint8_t  colmod   = ST7789::COLMOD_RGB565;
+  static constexpr bool     invert   = true;
+  static constexpr uint32_t spi_hz   = 80000000;
+};
+
+struct ST7789_240x320 {
+  using Controller = ST7789;
+  using Pins = C6DevkitPins;
+  static constexpr uint16_t width    = 240;
+  static constexpr uint16_t height   = 320;
+  static constexpr uint16_t offset_x = 0;
+  static constexpr uint16_t offset_y = 0;
+  static constexpr uint8_t  madctl   = 0x00;
+  static constexpr uint8_t  colmod   = ST7789::COLMOD_RGB565;
+  static constexpr bool     invert   = true;
+  static constexpr uint32_t spi_hz   = 80000000;
+};
+
+struct ILI9341_240x320 {
+  using Controller = ILI9341;
+  using Pins = C6DevkitPins;
+  static constexpr uint16_t width    = 240;
+  static constexpr uint16_t height   = 320;
+  static constexpr uint16_t offset_x = 0;
+  static constexpr uint16_t offset_y = 0;
+  static constexpr uint8_t  madctl   = 0x08;  // BGR panel
+  static constexpr uint8_t  colmod   = ILI9341::COLMOD_RGB565;
+  static constexpr bool     invert   = false;
+  static constexpr uint32_t spi_hz   = 40000000;  // ILI9341 write cycle limit
+};
+
+#if defined(PANEL_ILI9341_240X320)
+using PanelConfig = ILI9341_240x320;
+#elif defined(PANEL_ST7789_240X320)
+using PanelConfig = ST7789_240x320;
+#else
+using PanelConfig = ST7789_172x320;
+#endif
@@ -0,0 +1,181 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+  Compile-time SPI panel driver
+
+  A panel is described by a config struct of constexpr members (controller
+  command set, geometry, RAM offsets, pin map, color mode, SPI clock).
+  PanelDriver<Config> only has static inline members, so the flush path
+  (set_window + write_pixels) compiles to straight-line bus calls with no
+  virtual dispatch. The bus is a template parameter as well so the driver
+  can be instantiated against a recording mock instead of the Arduino SPI
+  (include/Panel_Spi_Bus.h; host check in scripts/check_panel.cpp).
+
+  A bus provides begin(), reset(), delay_ms(ms), command(cmd),
+  data(bytes, len) and pixels_msb_first(pixels, count), the last sending
+  each RGB565 value high byte first.
+******************************************************************************/
+
+// Init sequence encoding: CMD, ARGC[|PANEL_SEQ_DELAY], ARGS..., [DELAY_MS]
+#define PANEL_SEQ_DELAY 0x80
+
+// Panel refresh rate levels, selected by display activity
+enum PanelRate : uint8_t {
+  PANEL_RATE_POWER_SAVE = 0,   // Disconnected, backlight off
+  PANEL_RATE_STATIC,           // Content unchanged between updates
+  PANEL_RATE_ACTIVE,           // Animations and page changes (init sequence rate)
+  PANEL_RATE_COUNT
+};
+
+// MIPI DCS commands shared by ST7789 and ILI9341
+struct MipiDcs {
+  static constexpr uint8_t SWRESET = 0x01;
+  static constexpr uint8_t SLPOUT  = 0x11;
+  static constexpr uint8_t INVOFF  = 0x20;
+  static constexpr uint8_t INVON   = 0x21;
+  static constexpr uint8_t DISPON  = 0x29;
+  static constexpr uint8_t CASET   = 0x2A;
+  static constexpr uint8_t RASET   = 0x2B;
+  static constexpr uint8_t RAMWR   = 0x2C;
+  static constexpr uint8_t MADCTL  = 0x36;
+  static constexpr uint8_t COLMOD  = 0x3A;
+};
+
+// Sitronix ST7789 (power, porch and gamma settings from the Waveshare 1.47" panel)
+struct ST7789 : MipiDcs {
+  static constexpr uint8_t COLMOD_RGB565 = 0x05;
+  static constexpr bool pixels_msb_first = false;   // RAMCTRL below selects little-endian RGB565
+  static constexpr uint8_t init_sequence[] = {
+    0xB0, 2, 0x00, 0xE8,                        // RAMCTRL
+    0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,      // PORCTRL
+    0xB7, 1, 0x35,                              // GCTRL
+    0xBB, 1, 0x35,                              // VCOMS
+    0xC0, 1, 0x2C,                              // LCMCTRL
+    0xC2, 1, 0x01,                              // VDVVRHEN
+    0xC3, 1, 0x13,                              // VRHS
+    0xC4, 1, 0x20,                              // VDVS
+    0xC6, 1, 0x0F,                              // FRCTRL2: 60 Hz
+    0xD0, 2, 0xA4, 0xA1,                        // PWCTRL1
+    0xD6, 1, 0xA1,
+    0xE0, 14, 0xF0, 0x00, 0x04, 0x04, 0x04, 0x05, 0x29, 0x33, 0x3E, 0x38, 0x12, 0x12, 0x28, 0x30,
+    0xE1, 14, 0xF0, 0x07, 0x0A, 0x0D, 0x0B, 0x07, 0x28, 0x33, 0x3E, 0x36, 0x14, 0x14, 0x29, 0x32,
+  };
+
+  // Per PanelRate, same encoding as init_sequence:
+  // FR = 10 MHz / ((320 + FPA + BPA) * (250 + 16 * RTNA))
+  static constexpr uint8_t rate_sequences[PANEL_RATE_COUNT][10] = {
+    { 0xB2, 5, 0x7F, 0x7F, 0x00, 0x33, 0x33,  0xC6, 1, 0x1F },   // Max porches, RTNA 31: 23 Hz
+    { 0xB2, 5, 0x3F, 0x3F, 0x00, 0x33, 0x33,  0xC6, 1, 0x1F },   // 30 Hz
+    { 0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,  0xC6, 1, 0x0F },   // Init values: 60 Hz
+  };
+};
+
+// Ilitek ILI9341
+struct ILI9341 : MipiDcs {
+  static constexpr uint8_t COLMOD_RGB565 = 0x55;
+  static constexpr bool pixels_msb_first = true;    // No little-endian mode on the serial interface
+  static constexpr uint8_t init_sequence[] = {
+    0xCF, 3, 0x00, 0xC1, 0x30,                  // Power control B
+    0xED, 4, 0x64, 0x03, 0x12, 0x81,            // Power on sequence
+    0xE8, 3, 0x85, 0x00, 0x78,                  // Driver timing A
+    0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,      // Power control A
+    0xF7, 1, 0x20,                              // Pump ratio
+    0xEA, 2, 0x00, 0x00,                        // Driver timing B
+    0xC0, 1, 0x23,                              // PWCTR1
+    0xC1, 1, 0x10,                              // PWCTR2
+    0xC5, 2, 0x3E, 0x28,                        // VMCTR1
+    0xC7, 1, 0x86,                              // VMCTR2
+    0xB1, 2, 0x00, 0x18,                        // FRMCTR1: 79 Hz
+    0xB6, 3, 0x08, 0x82, 0x27,                  // DFUNCTR
+    0xF2, 1, 0x00,                              // 3Gamma off
+    0x26, 1, 0x01,                              // GAMMASET
+    0xE0, 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+    0xE1, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+  };
+
+  // Per PanelRate: FRMCTR1 DIVA (fosc divider) and RTNA (clocks per line).
+  // Porches (B5h) stay at their defaults; the divider alone covers the range.
+  static constexpr uint8_t rate_sequences[PANEL_RATE_COUNT][4] = {
+    { 0xB1, 2, 0x02, 0x1F },   // fosc/4, 61 Hz table: 15 Hz
+    { 0xB1, 2, 0x01, 0x1B },   // fosc/2, 70 Hz table: 35 Hz
+    { 0xB1, 2, 0x00, 0x18 },   // Init values: 79 Hz
+  };
+};
+
+template <typename Config, typename Bus>
+class PanelDriver {
+public:
+  using Controller = typename Config::Controller;
+  static constexpr uint16_t width  = Config::width;
+  static constexpr uint16_t height = Config::height;
+
+  static void init() {
+    Bus::begin();
+    Bus::reset();
+
+    Bus::command(Controller::SLPOUT);
+    Bus::delay_ms(120);
+    command(Controller::MADCTL, Config::madctl);
+    command(Controller::COLMOD, Config::colmod);
+    run_sequence(Controller::init_sequence, sizeof(Controller::init_sequence));
+    Bus::command(Config::invert ? Controller::INVON : Controller::INVOFF);
+
+    // Already out of sleep; frame memory can be written right after DISPON
+    Bus::command(Controller::DISPON);
+  }
+
+  // Change the panel's internal refresh rate (and porches where the controller has them)
+  static void set_frame_rate(PanelRate rate) {
+    if (rate < PANEL_RATE_COUNT) {
+      run_sequence(Controller::rate_sequences[rate], sizeof(Controller::rate_sequences[rate]));
+    }
+  }
+
+  // Set the RAM write window (inclusive, panel coordinates before offsets) and start RAMWR
+  static inline void set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    const uint16_t xs = x0 + Config::offset_x, xe = x1 + Config::offset_x;
+    const uint16_t ys = y0 + Config::offset_y, ye = y1 + Config::offset_y;
+    const uint8_t caset[4] = { (uint8_t)(xs >> 8), (uint8_t)xs, (uint8_t)(xe >> 8), (uint8_t)xe };
+    const uint8_t raset[4] = { (uint8_t)(ys >> 8), (uint8_t)ys, (uint8_t)(ye >> 8), (uint8_t)ye };
+
+    Bus::command(Controller::CASET);
+    Bus::data(caset, sizeof(caset));
+    Bus::command(Controller::RASET);
+    Bus::data(raset, sizeof(raset));
+    Bus::command(Controller::RAMWR);
+  }
+
+  // Stream native RGB565 pixels into the current window, in the controller's byte order
+  static inline void write_pixels(const uint16_t *pixels, uint32_t count) {
+    if (Controller::pixels_msb_first) {
+      Bus::pixels_msb_first(pixels, count);
+    } else {
+      Bus::data(reinterpret_cast<const uint8_t *>(pixels), count * sizeof(uint16_t));
+    }
+  }
+
+private:
+  static inline void command(uint8_t cmd, uint8_t arg) {
+    Bus::command(cmd);
+    Bus::data(&arg, 1);
+  }
+
+  static void run_sequence(const uint8_t *seq, size_t len) {
+    size_t i = 0;
+    while (i + 1 < len) {
+      const uint8_t cmd  = seq[i++];
+      const uint8_t argc = seq[i] & ~PANEL_SEQ_DELAY;
+      const bool    wait = seq[i++] & PANEL_SEQ_DELAY;
+      Bus::command(cmd);
+      if (argc) {
+        Bus::data(&seq[i], argc);
+        i += argc;
+      }
+      if (wait) {
+        Bus::delay_ms(seq[i++]);
+      }
+    }
+  }
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+#include <SPI.h>
+#include "Panel_Driver.h"
+
+/******************************************************************************
+  Arduino SPI bus for PanelDriver
+
+  One SPI transaction per command/data burst, CS and DC driven as GPIOs.
+  Kept apart from Panel_Driver.h so the driver builds on the host against
+  a mock bus.
+******************************************************************************/
+
+template <typename Config>
+struct ArduinoSpiBus {
+  using Pins = typename Config::Pins;
+
+  static void begin() {
+    pinMode(Pins::cs, OUTPUT);
+    pinMode(Pins::dc, OUTPUT);
+    pinMode(Pins::rst, OUTPUT);
+    SPI.begin(Pins::sclk, Pins::miso, Pins::mosi);
+  }
+
+  static void reset() {
+    digitalWrite(Pins::cs, LOW);
+    delay(50);
+    digitalWrite(Pins::rst, LOW);
+    delay(50);
+    digitalWrite(Pins::rst, HIGH);
+    delay(50);
+  }
+
+  static inline void delay_ms(uint32_t ms) { delay(ms); }
+  static inline void command(uint8_t cmd) { transfer(LOW, &cmd, 1); }
+  static inline void data(const uint8_t *bytes, uint32_t len) { transfer(HIGH, bytes, len); }
+
+  // writePixels() sends each 16-bit value high byte first in the SPI hardware loop
+  static inline void pixels_msb_first(const uint16_t *pixels, uint32_t count) {
+    begin_data(HIGH);
+    SPI.writePixels(pixels, count * sizeof(uint16_t));
+    end_data();
+  }
+
+private:
+  static inline void begin_data(uint8_t dc) {
+    SPI.beginTransaction(SPISettings(Config::spi_hz, MSBFIRST, SPI_MODE0));
+    digitalWrite(Pins::cs, LOW);
+    digitalWrite(Pins::dc, dc);
+  }
+
+  static inline void end_data() {
+    digitalWrite(Pins::cs, HIGH);
+    SPI.endTransaction();
+  }
+
+  static inline void transfer(uint8_t dc, const uint8_t *bytes, uint32_t len) {
+    begin_data(dc);
+    SPI.writeBytes(bytes, len);
+    end_data();
+  }
+};
@@ -0,0 +1,76 @@
+#pragma once
+#include <Arduino.h>
+
+/******************************************************************************
+  Multiplexed, prioritized channels over the serial link
+
+  Every message travels in its own frame on one of four channels, sent in
+  priority order:
+
+    MUX_REALTIME   live metric lines (STR:/EXT:/base frames)
+    MUX_CONTROL    commands and their short replies (DUMP, HELLO, EVICT:)
+    MUX_LOG        debug and error text
+    MUX_BULK       long transfers (black-box dump), a byte stream in chunks
+
+  Frame before encoding: <channel << 4 | flags> <seq> <payload> <crc16 BE>
+  (CRC-16/CCITT-FALSE over header and payload, seq counts per channel). The
+  frame is COBS-encoded and sent between 0x00 delimiters, so a lost byte
+  costs one frame and the receiver resyncs at the next delimiter. Bytes
+  outside frames are legacy newline-terminated lines.
+
+  The host opens with a HELLO control frame. The device answers framed and
+  sends framed from then on; a legacy line switches it back to plain lines,
+  so older hosts keep working. In both modes queued messages leave whole and
+  by priority, so log text never splits a reply. Bulk data goes out at most
+  one MUX_BULK_CHUNK at a time and only into an idle transmit buffer, so a
+  realtime or control message waits at most one chunk time behind it. In
+  line mode other messages wait until the bulk stream is at a line
+  boundary, so they never land inside a dump line.
+
+  The receiver checks each channel's seq for gaps; a bulk transfer with a
+  gap, or whose FIN carries MUX_FLAG_ERROR, is incomplete.
+******************************************************************************/
+
+#define MUX_VERSION         1
+#define MUX_MAX_PAYLOAD     127     // One line without its newline (SERIAL_BUFFER_SIZE - 1)
+#define MUX_BULK_CHUNK      48      // ~4 ms at 115200 baud
+#define MUX_FLAG_FIN        0x01    // Last chunk of a bulk transfer
+#define MUX_FLAG_ERROR      0x02    // With FIN: bytes of the transfer were dropped on a full queue
+
+enum MuxChannel : uint8_t {
+  MUX_REALTIME = 0,
+  MUX_CONTROL,
+  MUX_LOG,
+  MUX_BULK,
+  MUX_CHANNELS
+};
+
+enum MuxResult : uint8_t {
+  MUX_NONE = 0,               // Nothing complete yet
+  MUX_LINE,                   // A message or legacy line is in the caller's buffer
+  MUX_OVERFLOW,               // Legacy line longer than the buffer, truncated
+};
+
+void Mux_Init();
+
+// Read available bytes until one message is complete; `channel` is MUX_REALTIME for legacy lines
+MuxResult Mux_Receive(char *line, size_t size, size_t *len, MuxChannel *channel);
+
+// Queue one message (no newline); log messages are dropped on a full queue, others wait up to 50 ms
+void Mux_Send(MuxChannel channel, const char *text, size_t len);
+void Mux_Print(MuxChannel channel, const char *text);
+void Mux_Printf(MuxChannel channel, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+// Bulk stream writer (blocks on a full queue while draining it) and end-of-transfer marker
+Print &Mux_Bulk();
+void Mux_EndBulk();
+
+// Write queued messages by priority without blocking; call every loop iteration
+void Mux_Poll();
+
+// True while the host speaks frames
+bool Mux_Framed();
+
+// Frames dropped for a bad CRC or length, and messages or bulk writes dropped on a full queue
+uint32_t Mux_BadFrames();
+uint32_t Mux_Dropped();
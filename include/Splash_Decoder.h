@@ -0,0 +1,115 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/******************************************************************************
+  Boot splash decoder
+
+  Splash images are generated by scripts/make_splash.py from assets/ and
+  stored in panel-native scanline order as RGB565 (the same 16-bit values
+  LVGL flushes). The stream is a QOI-style sequence of byte ops:
+
+    00xxxxxx             run of the previous color, 1-64 pixels
+    01xxxxxx             color from the 64-entry recent-color index
+    10xxxxxx yyyyyyyy    run of the previous color, 65-16448 pixels
+    11111111 lo hi       literal color, also stored in the index
+
+  Runs continue across scanlines. The previous color starts as the
+  background and the index starts zeroed. Decoding needs no frame buffer:
+  next_line() fills one scanline at a time for the caller to stream out.
+******************************************************************************/
+
+#define SPLASH_MAGIC        "S565"
+#define SPLASH_HEADER_LEN   10      // Magic, width, height, background (uint16 LE)
+#define SPLASH_INDEX_SIZE   64
+#define SPLASH_OP_RUN       0x00
+#define SPLASH_OP_INDEX     0x40
+#define SPLASH_OP_LONG_RUN  0x80
+#define SPLASH_OP_LITERAL   0xFF
+#define SPLASH_SHORT_RUN    64
+
+static inline uint8_t splash_hash(uint16_t color) {
+  return ((color >> 11) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) % SPLASH_INDEX_SIZE;
+}
+
+class SplashDecoder {
+public:
+  // Validate the header and reset the decoder; false if the data is not a splash image
+  bool begin(const uint8_t *data, size_t len) {
+    if (len < SPLASH_HEADER_LEN || memcmp(data, SPLASH_MAGIC, 4) != 0) {
+      return false;
+    }
+    width_ = read16(data + 4);
+    height_ = read16(data + 6);
+    background_ = read16(data + 8);
+    pos_ = data + SPLASH_HEADER_LEN;
+    end_ = data + len;
+    prev_ = background_;
+    run_ = 0;
+    memset(index_, 0, sizeof(index_));
+    return width_ > 0 && height_ > 0;
+  }
+
+  uint16_t width() const { return width_; }
+  uint16_t height() const { return height_; }
+  uint16_t background() const { return background_; }
+
+  // Decode the next scanline into `line` (width() pixels); false on corrupt or truncated data
+  bool next_line(uint16_t *line) {
+    uint16_t x = 0;
+    while (x < width_) {
+      if (run_) {
+        uint32_t n = run_ < (uint32_t)(width_ - x) ? run_ : (uint32_t)(width_ - x);
+        for (uint32_t i = 0; i < n; i++) {
+          line[x + i] = prev_;
+        }
+        x += n;
+        run_ -= n;
+        continue;
+      }
+      if (pos_ >= end_) {
+        return false;
+      }
+
+      const uint8_t op = *pos_++;
+      switch (op & 0xC0) {
+        case SPLASH_OP_RUN:
+          run_ = (op & 0x3F) + 1;
+          break;
+        case SPLASH_OP_INDEX:
+          prev_ = index_[op & 0x3F];
+          line[x++] = prev_;
+          break;
+        case SPLASH_OP_LONG_RUN:
+          if (pos_ >= end_) {
+            return false;
+          }
+          run_ = (((uint32_t)(op & 0x3F) << 8) | *pos_++) + SPLASH_SHORT_RUN + 1;
+          break;
+        default:
+          if (op != SPLASH_OP_LITERAL || end_ - pos_ < 2) {
+            return false;
+          }
+          prev_ = read16(pos_);
+          pos_ += 2;
+          index_[splash_hash(prev_)] = prev_;
+          line[x++] = prev_;
+          break;
+      }
+    }
+    return true;
+  }
+
+private:
+  static inline uint16_t read16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+  const uint8_t *pos_ = nullptr;
+  const uint8_t *end_ = nullptr;
+  uint32_t run_ = 0;
+  uint16_t prev_ = 0;
+  uint16_t width_ = 0;
+  uint16_t height_ = 0;
+  uint16_t background_ = 0;
+  uint16_t index_[SPLASH_INDEX_SIZE];
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Boot splash stream (include/Splash_Decoder.h format), generated into src/Splash_Image.c
+extern const uint8_t splash_image[];
+extern const uint32_t splash_image_len;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+
+/******************************************************************************
+  Interned string table for text fields on the wire
+
+  The host defines a string once ("STR:<id>=<text>") and frames reference it
+  by ID. The device keeps the STRDICT_SLOTS most recently used definitions;
+  defining into a full table evicts the least recently used entry, and the
+  caller reports the evicted ID back to the host ("EVICT:<id>") so it is
+  redefined before its next use. ID 0 means "no string".
+******************************************************************************/
+
+#ifndef STRDICT_SLOTS
+#define STRDICT_SLOTS   16
+#endif
+#define STRDICT_MAX_LEN 23      // Longer definitions are truncated
+#define STRDICT_NONE    0
+
+struct StringDictEntry {
+  uint8_t  id;                  // STRDICT_NONE when the slot is free
+  uint8_t  version;             // Generation of the current definition
+  uint16_t last_use;            // LRU clock value
+  char     text[STRDICT_MAX_LEN + 1];
+};
+
+struct StringDict {
+  StringDictEntry entries[STRDICT_SLOTS];
+  uint16_t clock;
+  uint8_t  generation;
+};
+
+void StrDict_Init(StringDict &d);
+
+// Define or redefine `id`; returns the ID evicted to make room, or STRDICT_NONE
+uint8_t StrDict_Define(StringDict &d, uint8_t id, const char *text, size_t len);
+
+// Look up and mark as used; NULL if the ID is not held
+const char *StrDict_Lookup(StringDict &d, uint8_t id);
+
+// Version of the current definition (0 if not held), to detect redefinitions
+uint8_t StrDict_Version(const StringDict &d, uint8_t id);
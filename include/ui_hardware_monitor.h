@@ -10,27 +10,104 @@ extern "C" {
 // UI Elements for Hardware Monitor
 extern lv_obj_t * ui_HWMonScreen;
 
-// Dual-label approach: Prefix (white) + Value (dynamic color)
-extern lv_obj_t * ui_CPULabel_Prefix;
-extern lv_obj_t * ui_CPULabel_Value;
+// One icon + value row widget per metric (ui_metric_row.h)
+extern lv_obj_t * ui_CPURow;
+extern lv_obj_t * ui_GPURow;
+extern lv_obj_t * ui_RAMRow;
+extern lv_obj_t * ui_TempRow;
+extern lv_obj_t * ui_NetRow;
+extern lv_obj_t * ui_BatRow;
 
-extern lv_obj_t * ui_GPULabel_Prefix;
-extern lv_obj_t * ui_GPULabel_Value;
+// CPU time breakdown under the CPU value (ui_stacked_bar.h)
+extern lv_obj_t * ui_CPUBar;
+extern lv_obj_t * ui_AlertLabel;
 
-extern lv_obj_t * ui_RAMLabel_Prefix;
-extern lv_obj_t * ui_RAMLabel_Value;
+// Stats page
+extern lv_obj_t * ui_StatsScreen;
+extern lv_obj_t * ui_StatsTable;
 
-extern lv_obj_t * ui_TempLabel_Prefix;
-extern lv_obj_t * ui_TempLabel_Value;
+// History page
+extern lv_obj_t * ui_HistoryScreen;
+extern lv_obj_t * ui_HistoryChart;
+extern lv_obj_t * ui_HistoryLabel_Title;
+extern lv_obj_t * ui_HistoryLabel_Host;
 
-extern lv_obj_t * ui_NetLabel_Prefix;
-extern lv_obj_t * ui_NetLabel_Value;
+// Memory detail page
+extern lv_obj_t * ui_MemoryScreen;
+extern lv_obj_t * ui_MemoryTable;
 
-extern lv_obj_t * ui_BatIcon;
-extern lv_obj_t * ui_BatLabel_Value;
+// NUMA node page
+extern lv_obj_t * ui_NumaScreen;
+extern lv_obj_t * ui_NumaTable;
+
+// CPU idle-state residency page
+extern lv_obj_t * ui_CStateScreen;
+extern lv_obj_t * ui_CStateTable;
+
+// Custom metrics page
+extern lv_obj_t * ui_CustomScreen;
+extern lv_obj_t * ui_CustomTable;
+
+#define UI_CUSTOM_ROWS 6        // Host-pushed metrics shown (pc_monitor_ingest.MAX_METRICS)
+#define UI_NUMA_NODES 8         // Nodes shown, two columns of four (pc_monitor.MAX_NUMA_NODES)
+#define UI_CSTATE_SLOTS 10      // Active plus up to 9 idle states (pc_monitor_cpuidle.MAX_STATES)
+
+#define UI_HISTORY_POINTS 160   // Chart points across the selected span
+#define UI_HISTORY_GAP    0xFF  // Sample without data (matches HISTORY_NO_DATA)
+
+// Pages, cycled with the BOOT button
+typedef enum {
+    UI_PAGE_MAIN = 0,
+    UI_PAGE_STATS,
+    UI_PAGE_HISTORY,
+    UI_PAGE_MEMORY,
+    UI_PAGE_NUMA,
+    UI_PAGE_CSTATES,
+    UI_PAGE_CUSTOM,
+    UI_PAGE_COUNT
+} ui_page_t;
+
+// Rows of the stats page
+typedef enum {
+    UI_STATS_CPU = 0,
+    UI_STATS_GPU,
+    UI_STATS_RAM,
+    UI_STATS_TEMP,
+    UI_STATS_COUNT
+} ui_stats_row_t;
+
+// Dashboard value rendering (build with -DUI_SEGMENT_DIGITS to start in segment mode)
+typedef enum {
+    UI_DIGITS_FONT = 0,         // Montserrat 32 glyphs
+    UI_DIGITS_SEGMENT,          // 7-segment fills, units in Montserrat 16
+} ui_digit_style_t;
+
+// Segments of the CPU time bar, in CPUT: field order
+typedef enum {
+    UI_CPU_TIME_USER = 0,
+    UI_CPU_TIME_NICE,
+    UI_CPU_TIME_SYSTEM,
+    UI_CPU_TIME_IRQ,
+    UI_CPU_TIME_IOWAIT,
+    UI_CPU_TIME_STEAL,
+    UI_CPU_TIME_COUNT
+} ui_cpu_time_t;
+
+// Memory detail values, in MEMX: field order (pc_monitor.MEMORY_DETAIL_FIELDS)
+typedef enum {
+    UI_MEM_SWAP_USED = 0,       // MB
+    UI_MEM_SWAP_TOTAL,          // MB
+    UI_MEM_CACHE,               // MB, page cache and buffers
+    UI_MEM_DIRTY,               // MB
+    UI_MEM_SWAP_IN,             // KB/s
+    UI_MEM_SWAP_OUT,            // KB/s
+    UI_MEM_MAJOR_FAULTS,        // Per second
+    UI_MEM_COUNT
+} ui_memory_field_t;
 
 // Functions
 void ui_hardware_monitor_init(void);
+void ui_set_digit_style(ui_digit_style_t style);
 
 // UI update functions with additional parameters
 void ui_update_cpu(float percent, float freq_ghz);
@@ -38,7 +115,44 @@ void ui_update_gpu(float percent);
 void ui_update_ram(float percent, float used_gb, float total_gb);
 void ui_update_temp(float celsius, int fan_rpm);
 void ui_update_network(float download_mbps, float upload_mbps);
+void ui_set_network_warning(bool warning);  // Overrides the network value color until cleared
 void ui_update_battery(int percent, float power_watts);
+void ui_update_cpu_times(const uint16_t *tenths);   // UI_CPU_TIME_COUNT values, NULL hides the bar
+void ui_update_cpu_throttle(bool throttled, uint8_t limit_pct);   // Warning icon on the CPU row
+void ui_set_alert(const char *text);    // Dashboard alert badge over the battery row, NULL hides it
+
+// Page navigation
+void ui_show_page(ui_page_t page);
+void ui_next_page(void);
+ui_page_t ui_current_page(void);
+
+// Stats page: window length shown in the header, windowed p95/max/avg and session peak for one metric
+void ui_set_stats_window(int minutes);
+
+// History page: span selected by the button, samples in half units, oldest first
+uint32_t ui_history_span_s(void);
+void ui_update_history(const uint8_t *cpu, const uint8_t *temp);
+
+void ui_update_stats(ui_stats_row_t row, float p95, float max, float avg, float peak);
+
+// Host and interface names from the string dictionary (NULL when not known)
+void ui_set_host_label(const char *host, const char *iface);
+
+// Memory detail page: UI_MEM_COUNT values, NULL shows "--" for every row
+void ui_update_memory(const uint32_t *values);
+
+// Disk row of the memory page: used % of the fullest filesystem and its mount point, negative shows "--"
+void ui_update_disk(int percent, const char *mount);
+
+// NUMA page: CPU % and memory used % per node as (cpu, mem) pairs; nodes 0 shows a placeholder
+void ui_update_numa(const uint8_t *values, uint8_t nodes);
+
+// C-state page: residency in tenths of a percent, active first, then each idle state with its name
+// (names[0] is unused, NULL names show the state number); count 0 shows a placeholder
+void ui_update_cstates(const uint16_t *tenths, const char * const *names, uint8_t count);
+
+// Custom metrics page: name and formatted value of one row (NULL name blanks the row)
+void ui_update_custom(uint8_t row, const char *name, const char *value);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,50 @@
+#ifndef UI_METRIC_ROW_H
+#define UI_METRIC_ROW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lvgl.h>
+
+/*
+ * Dashboard row widget: a static icon and a dynamic value drawn by one
+ * object with fixed geometry. Updates never trigger a layout pass and only
+ * invalidate the union of the old and new value (or icon) rectangles.
+ * Icon strings must be static (e.g. LV_SYMBOL_*); the value is copied.
+ *
+ * In segment mode digits, '-', '.', ':' and spaces are drawn as 7-segment
+ * characters from opaque axis-aligned fills (no glyph data, no blending) and
+ * only the character cells that changed are invalidated. Any other
+ * character (units, symbols) is drawn baseline-aligned from unit_font.
+ */
+
+#define UI_METRIC_ROW_MAX_LEN 32
+
+typedef enum {
+    UI_METRIC_ROW_FONT = 0,     // Value drawn with value_font
+    UI_METRIC_ROW_SEGMENT,      // Numerals as 7-segment fills, the rest with unit_font
+} ui_metric_row_mode_t;
+
+extern const lv_obj_class_t ui_metric_row_class;
+
+// value_x: value offset from the left edge; with align_right the icon sits at
+// the right edge and the value ends value_x pixels left of it
+lv_obj_t * ui_metric_row_create(lv_obj_t * parent, const lv_font_t * icon_font,
+                                const lv_font_t * value_font, lv_coord_t value_x, bool align_right);
+
+void ui_metric_row_set_icon(lv_obj_t * obj, const char * icon, lv_color_t color);
+void ui_metric_row_set_value(lv_obj_t * obj, const char * text, lv_color_t color);
+
+// Switch the value render mode; segments are sized from value_font's line height
+void ui_metric_row_set_mode(lv_obj_t * obj, ui_metric_row_mode_t mode, const lv_font_t * unit_font);
+
+// Profiling: rows created and value/icon invalidations issued since boot
+uint32_t ui_metric_row_count(void);
+uint32_t ui_metric_row_invalidations(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_METRIC_ROW_H
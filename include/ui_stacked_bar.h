@@ -0,0 +1,31 @@
+#ifndef UI_STACKED_BAR_H
+#define UI_STACKED_BAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <lvgl.h>
+
+/*
+ * Horizontal stacked bar: up to UI_STACKED_BAR_MAX_SEGMENTS colored
+ * segments laid end to end from the left over a track color. A pixel column
+ * only changes when a segment boundary crosses it, so an update invalidates
+ * just the spans between each moved boundary's old and new position.
+ */
+
+#define UI_STACKED_BAR_MAX_SEGMENTS 8
+
+extern const lv_obj_class_t ui_stacked_bar_class;
+
+// colors: one per segment, copied; the track shows where the segments end
+lv_obj_t * ui_stacked_bar_create(lv_obj_t * parent, uint8_t count, const lv_color_t * colors, lv_color_t track);
+
+// values: one per segment in units of `total` (e.g. tenths of a percent of 1000)
+void ui_stacked_bar_set_values(lv_obj_t * obj, const uint16_t * values, uint16_t total);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_STACKED_BAR_H
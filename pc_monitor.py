@@ -4,38 +4,188 @@ PC Hardware Monitor for ESP32-C6-LCD-1.47
 Reads CPU usage, RAM usage, and k10temp temperature and sends to ESP32 via serial
 """
 
+import argparse
+import collections
 import time
 import serial
 import serial.tools.list_ports
+import fnmatch
+import math
 import glob
 import sys
 import os
-from typing import Optional, Tuple
+import re
+import socket
+from typing import Dict, List, Optional, Tuple
+
+from pc_monitor_cpuidle import DEFAULT_BUDGET_MS as DEFAULT_CPUIDLE_BUDGET_MS, CpuIdleMonitor
+from pc_monitor_exporter import CollectorStats, start_exporter
+from pc_monitor_fs import DEFAULT_ALERT_PCT as DEFAULT_FS_ALERT_PCT, FsMonitor
+from pc_monitor_irq import DEFAULT_BUDGET_MS as DEFAULT_IRQ_BUDGET_MS, IrqMonitor
+from pc_monitor_ingest import MAX_METRICS as CUSTOM_METRIC_SLOTS, default_socket_path, start_ingest
+from pc_monitor_mux import BULK, CONTROL, FLAG_ERROR, FLAG_FIN, FLAG_GAP, REALTIME, SerialMux
+from pc_monitor_lowimpact import (DEFAULT_TIMER_SLACK_MS, CoarseTimer, FootprintMeter, ProcReader,
+                                  apply_low_interference, freeze_heap, parse_cpu_list, split_lines)
+
+# Must match DATA_TIMEOUT_MS in src/main.cpp
+DEVICE_DATA_TIMEOUT_S = 5.0
+
+# /proc/stat CPU time categories, in column order (guest time is already included in user/nice)
+CPU_TIME_COLUMNS = ('user', 'nice', 'system', 'idle', 'iowait', 'irq', 'softirq', 'steal')
+
+# CPUT: field segments, in bar order (must match ui_cpu_time_t in ui_hardware_monitor.h)
+CPU_TIME_SEGMENTS = ('user', 'nice', 'system', 'irq', 'iowait', 'steal')
+
+# THR: flag bits (must match the THROTTLE_* flags in main.cpp)
+THROTTLE_CAPPED = 1     # scaling_max_freq below cpuinfo_max_freq on at least one core
+THROTTLE_THERMAL = 2    # thermal_throttle event counters advanced since the last sample
+
+# /proc/meminfo and /proc/vmstat entries kept from the single pass over each file
+MEMINFO_KEYS = (b'MemTotal', b'MemAvailable', b'Buffers', b'Cached', b'SwapTotal', b'SwapFree',
+                b'Dirty', b'Writeback')
+VMSTAT_KEYS = (b'pswpin', b'pswpout', b'pgmajfault')
+VMSTAT_LINE = re.compile(rb'^(' + b'|'.join(VMSTAT_KEYS) + rb') (\d+)$', re.MULTILINE)
+
+# MEMX: field order (must match ui_memory_detail_t in ui_hardware_monitor.h)
+MEMORY_DETAIL_FIELDS = ('swap_used_mb', 'swap_total_mb', 'cache_mb', 'dirty_mb',
+                        'swap_in_kbs', 'swap_out_kbs', 'major_faults')
+
+# /proc/net/snmp ("Tcp:") and /proc/net/netstat ("TcpExt:") counters behind the TCP: field
+TCP_SNMP_KEYS = (b'ActiveOpens', b'PassiveOpens', b'OutSegs', b'RetransSegs')
+TCP_NETSTAT_KEYS = (b'ListenDrops',)
+TCP_MIN_SEGMENTS = 100     # Fewer segments sent in an interval give no meaningful retransmit ratio
+
+# NUMA: field limit (must match UI_NUMA_NODES in ui_hardware_monitor.h)
+MAX_NUMA_NODES = 8
+
+# Longest line the device accepts (SERIAL_BUFFER_SIZE - 1, excluding the newline)
+SERIAL_LINE_MAX = 127
+
+class RateWindow:
+    """Fixed-capacity ring of (timestamp, rx_bytes, tx_bytes) samples over a time window
+
+    Push and eviction are O(1) amortised and allocate nothing after construction;
+    the rate is taken between the oldest and newest samples inside the window.
+    The latest sample from before the window is kept as the oldest one, so a
+    sampling interval longer than the window still yields the rate over it.
+    """
+
+    def __init__(self, window_sec: float, capacity: int = 64):
+        self.window_sec = window_sec
+        self.capacity = capacity
+        self.times = [0.0] * capacity
+        self.rx = [0] * capacity
+        self.tx = [0] * capacity
+        self.head = 0    # Next slot to write
+        self.count = 0
+
+    def push(self, timestamp: float, rx_bytes: int, tx_bytes: int):
+        self.times[self.head] = timestamp
+        self.rx[self.head] = rx_bytes
+        self.tx[self.head] = tx_bytes
+        self.head = (self.head + 1) % self.capacity
+        self.count = min(self.count + 1, self.capacity)
+
+        # Evict samples older than the window, keeping the last one before it as the anchor
+        cutoff = timestamp - self.window_sec
+        while self.count > 2 and self.times[(self._oldest() + 1) % self.capacity] <= cutoff:
+            self.count -= 1
+
+    def _oldest(self) -> int:
+        return (self.head - self.count) % self.capacity
+
+    def rates(self) -> Tuple[float, float]:
+        """Return (rx, tx) in bytes/s across the window; (0, 0) until two samples exist"""
+        if self.count < 2:
+            return (0.0, 0.0)
+        oldest = self._oldest()
+        newest = (self.head - 1) % self.capacity
+        elapsed = self.times[newest] - self.times[oldest]
+        if elapsed <= 0:
+            return (0.0, 0.0)
+        # Counter resets (interface flap, driver reload) read as 0 rather than negative
+        return (max(0.0, (self.rx[newest] - self.rx[oldest]) / elapsed),
+                max(0.0, (self.tx[newest] - self.tx[oldest]) / elapsed))
+
 
 class SystemMonitor:
     """Monitor system metrics: CPU, RAM, Temperature, Fan, Network, and Battery"""
 
-    def __init__(self):
+    # Virtual interfaces skipped unless explicitly included
+    DEFAULT_NET_EXCLUDE = ['lo', 'docker*', 'veth*', 'br-*', 'virbr*', 'tailscale*', 'tun*', 'wg*']
+    NET_SPEED_REFRESH_SEC = 30.0
+
+    def __init__(self, net_include: Optional[List[str]] = None,
+                 net_exclude: Optional[List[str]] = None,
+                 net_aggregate: str = 'sum', root: str = '/',
+                 irq_budget_ms: float = DEFAULT_IRQ_BUDGET_MS,
+                 cpuidle_budget_ms: float = DEFAULT_CPUIDLE_BUDGET_MS,
+                 fs_mounts: Optional[List[str]] = None, fs_alert_pct: float = DEFAULT_FS_ALERT_PCT):
+        self.root = root           # Filesystem root for /proc and /sys (fixtures, containers)
         self.prev_cpu_stats = None
+        self.cpu_times: Dict[str, float] = {}   # Percent of all CPU time per category, last interval
+        self.mem_detail: Dict[str, float] = {}  # Swap, cache, dirty (MB) and swap/fault rates, MEMORY_DETAIL_FIELDS
+        self.prev_vmstat = None
+        self.tcp: Dict[str, float] = {}   # retrans_pct, retrans_per_s, active_opens, passive_opens, listen_drops (/s)
+        self.prev_tcp = None
+        self.tcp_available = True
+        self.snmp_columns: Dict[bytes, Tuple[bytes, List[int]]] = {}   # Line prefix -> (header, key columns)
+        self.page_kb = os.sysconf('SC_PAGE_SIZE') / 1024.0
+        self.cpufreq = None        # Per policy [cur reader, cap reader, hardware max kHz, cores]; None = rescan
+        self.throttle_counters: List[ProcReader] = []
+        self.prev_throttle_events = None
+        self.throttle: Dict[str, int] = {}   # flags, limit_pct, freq_pct, events (last interval)
         self.k10temp_path = None
         self.fan_sensor_path = None
         self.battery_path = None
         self.network_interface = None
-        self.net_rx_history = []   # [(timestamp, rx_bytes), ...]
-        self.net_tx_history = []   # [(timestamp, tx_bytes), ...]
         self.net_window_sec = 3.0  # Rolling average window in seconds
+        self.net_include = net_include or []
+        self.net_exclude = self.DEFAULT_NET_EXCLUDE if net_exclude is None else net_exclude
+        self.net_aggregate = net_aggregate   # 'sum' across interfaces or 'max' (busiest)
+        self.net_windows: Dict[str, RateWindow] = {}
+        self.net_link_mbps: Dict[str, int] = {}
+        self.net_link_checked = 0.0
+        self.net_utilization = 0.0  # Percent of link speed, -1 when unknown
+        self.net_busiest_iface = None  # Selected interface with the most traffic
         self.gpu_device_path = None
+        self.numa_nodes: List[Tuple[int, ProcReader]] = []   # (node number, meminfo reader), 2+ nodes only
+        self.cpu_node: Dict[bytes, int] = {}   # b'cpuN' -> index into numa_nodes
+        self.prev_node_ticks = None
+        self.numa: List[Tuple[float, float]] = []   # Per node (CPU %, memory used %)
+        self._find_numa_nodes()
+        # The per-CPU lines are only needed to split CPU time by node
+        self.proc_stat = ProcReader(self._path('/proc/stat'), limit=None if self.numa_nodes else 256)
+        self.proc_meminfo = ProcReader(self._path('/proc/meminfo'))
+        self.proc_vmstat = ProcReader(self._path('/proc/vmstat'), size=8192)
+        self.proc_net_dev = ProcReader(self._path('/proc/net/dev'))
+        self.proc_net_snmp = ProcReader(self._path('/proc/net/snmp'))
+        self.proc_net_netstat = ProcReader(self._path('/proc/net/netstat'), size=8192)
+        self.irq = IrqMonitor(self._path('/proc/interrupts'), self._path('/proc/softirqs'), irq_budget_ms)
+        self.cpuidle = CpuIdleMonitor(self._path('/sys/devices/system/cpu'), cpuidle_budget_ms)
+        self.fs = FsMonitor(self._path('/proc/self/mountinfo'), self._path, fs_mounts, alert_pct=fs_alert_pct)
 
         # Initialize sensors
         self._find_k10temp()
         self._find_fan_sensor()
         self._find_battery()
-        self._find_network_interface()
+        if not self.net_include:
+            self._find_network_interface()
+        else:
+            print(f"Network interfaces: include {self.net_include}, exclude {self.net_exclude}, "
+                  f"aggregate {self.net_aggregate}")
         self._find_gpu_device()
+        self._find_cpufreq()
     
+    def _path(self, path: str) -> str:
+        """Resolve an absolute /proc or /sys path under the configured root"""
+        if self.root == '/':
+            return path
+        return os.path.join(self.root, path.lstrip('/'))
+
     def _find_k10temp(self):
         """Find k10temp sensor in /sys/class/hwmon/"""
-        hwmon_paths = glob.glob('/sys/class/hwmon/hwmon*/name')
+        hwmon_paths = glob.glob(self._path('/sys/class/hwmon/hwmon*/name'))
         for path in hwmon_paths:
             try:
                 with open(path, 'r') as f:
@@ -50,9 +200,78 @@ class SystemMonitor:
         if not self.k10temp_path:
             print("Warning: k10temp sensor not found. Temperature will be 0.")
 
+    def _find_cpufreq(self):
+        """Open per-policy cpufreq readers and the thermal_throttle event counters"""
+        self._close_cpufreq()
+        self.prev_throttle_events = None
+        policies: Dict[str, list] = {}
+        packages = set()
+        cpu_dirs = glob.glob(self._path('/sys/devices/system/cpu/cpu[0-9]*'))
+        for cpu_dir in sorted(cpu_dirs, key=lambda d: int(os.path.basename(d)[3:])):
+            # cpuN/cpufreq links to its policy; cores sharing a policy are read once
+            policy = os.path.realpath(os.path.join(cpu_dir, 'cpufreq'))
+            if policy in policies:
+                policies[policy][3] += 1
+            else:
+                try:
+                    with open(os.path.join(policy, 'cpuinfo_max_freq')) as f:
+                        hw_max = int(f.read())
+                except (OSError, ValueError):
+                    continue
+                policies[policy] = [ProcReader(os.path.join(policy, 'scaling_cur_freq'), size=32),
+                                    ProcReader(os.path.join(policy, 'scaling_max_freq'), size=32),
+                                    hw_max, 1]
+
+            # Intel only: per-core counters, plus one package counter per physical package
+            throttle_dir = os.path.join(cpu_dir, 'thermal_throttle')
+            if not os.path.isdir(throttle_dir):
+                continue
+            self.throttle_counters.append(ProcReader(os.path.join(throttle_dir, 'core_throttle_count'), size=32))
+            try:
+                with open(os.path.join(cpu_dir, 'topology/physical_package_id')) as f:
+                    package = f.read().strip()
+            except OSError:
+                package = '0'
+            if package not in packages:
+                packages.add(package)
+                self.throttle_counters.append(
+                    ProcReader(os.path.join(throttle_dir, 'package_throttle_count'), size=32))
+
+        self.cpufreq = list(policies.values())
+        if self.cpufreq:
+            print(f"CPU frequency: {sum(p[3] for p in self.cpufreq)} cores in {len(self.cpufreq)} policies, "
+                  f"{len(self.throttle_counters)} thermal throttle counters")
+
+    def _close_cpufreq(self):
+        for cur, cap, _, _ in self.cpufreq or []:
+            cur.close()
+            cap.close()
+        for counter in self.throttle_counters:
+            counter.close()
+        self.throttle_counters = []
+
+    def _find_numa_nodes(self):
+        """Map CPUs to NUMA nodes from /sys/devices/system/node; single-node hosts keep the aggregate path"""
+        nodes = []
+        for node_dir in glob.glob(self._path('/sys/devices/system/node/node[0-9]*')):
+            try:
+                with open(os.path.join(node_dir, 'cpulist'), 'r') as f:
+                    cpus = parse_cpu_list(f.read())
+            except (OSError, ValueError):
+                continue
+            nodes.append((int(os.path.basename(node_dir)[4:]), cpus, node_dir))
+        if len(nodes) < 2:
+            return
+
+        for index, (node, cpus, node_dir) in enumerate(sorted(nodes)[:MAX_NUMA_NODES]):
+            self.numa_nodes.append((node, ProcReader(os.path.join(node_dir, 'meminfo'))))
+            for cpu in cpus:
+                self.cpu_node[b'cpu%d' % cpu] = index
+        print(f"NUMA: {len(nodes)} nodes" + (f", showing the first {MAX_NUMA_NODES}" if len(nodes) > MAX_NUMA_NODES else ""))
+
     def _find_fan_sensor(self):
         """Find fan sensor in /sys/class/hwmon/"""
-        fan_paths = glob.glob('/sys/class/hwmon/hwmon*/fan*_input')
+        fan_paths = glob.glob(self._path('/sys/class/hwmon/hwmon*/fan*_input'))
         if fan_paths:
             self.fan_sensor_path = fan_paths[0]
             print(f"Found fan sensor at: {self.fan_sensor_path}")
@@ -61,7 +280,7 @@ class SystemMonitor:
 
     def _find_battery(self):
         """Find battery in /sys/class/power_supply/"""
-        battery_dirs = glob.glob('/sys/class/power_supply/BAT*/')
+        battery_dirs = glob.glob(self._path('/sys/class/power_supply/BAT*/'))
         if battery_dirs:
             self.battery_path = battery_dirs[0]
             print(f"Found battery at: {self.battery_path}")
@@ -72,14 +291,14 @@ class SystemMonitor:
         """Find active network interface"""
         try:
             # Try to find default route interface from /proc/net/route
-            with open('/proc/net/route', 'r') as f:
+            with open(self._path('/proc/net/route'), 'r') as f:
                 lines = f.readlines()
                 for line in lines[1:]:  # Skip header line
                     fields = line.split()
                     if len(fields) >= 2 and fields[1] == '00000000':  # Default route (0.0.0.0)
                         iface = fields[0]
                         # Verify interface exists and is not loopback
-                        if iface != 'lo' and os.path.exists(f'/sys/class/net/{iface}'):
+                        if iface != 'lo' and os.path.exists(self._path(f'/sys/class/net/{iface}')):
                             self.network_interface = iface
                             print(f"Found network interface from default route: {self.network_interface}")
                             return
@@ -88,7 +307,7 @@ class SystemMonitor:
 
         # Fallback: Scan /sys/class/net/ for active interfaces
         try:
-            net_dir = '/sys/class/net'
+            net_dir = self._path('/sys/class/net')
             if os.path.exists(net_dir):
                 interfaces = os.listdir(net_dir)
                 # Filter out loopback and virtual interfaces, prioritize physical interfaces
@@ -133,7 +352,7 @@ class SystemMonitor:
         """Find GPU device in /sys/class/drm/"""
         try:
             # Look for DRM card devices
-            drm_cards = glob.glob('/sys/class/drm/card*')
+            drm_cards = glob.glob(self._path('/sys/class/drm/card*'))
             for card_path in sorted(drm_cards):
                 # Skip connector devices (e.g., card1-DP-1)
                 if '-' in os.path.basename(card_path):
@@ -159,59 +378,126 @@ class SystemMonitor:
             print("Info: No GPU device found. GPU usage will be omitted.")
 
     def get_cpu_usage(self) -> float:
-        """Calculate CPU usage percentage from /proc/stat"""
-        try:
-            with open('/proc/stat', 'r') as f:
-                line = f.readline()  # First line is total CPU
-                fields = line.split()
-
-                # CPU fields: user, nice, system, idle, iowait, irq, softirq, steal
-                user = int(fields[1])
-                nice = int(fields[2])
-                system = int(fields[3])
-                idle = int(fields[4])
-                iowait = int(fields[5])
-                irq = int(fields[6])
-                softirq = int(fields[7])
-
-                # Calculate total and idle time
-                total = user + nice + system + idle + iowait + irq + softirq
-                idle_total = idle + iowait
-
-                if self.prev_cpu_stats:
-                    prev_total, prev_idle = self.prev_cpu_stats
-                    total_diff = total - prev_total
-                    idle_diff = idle_total - prev_idle
-
-                    if total_diff > 0:
-                        cpu_usage = 100.0 * (total_diff - idle_diff) / total_diff
-                    else:
-                        cpu_usage = 0.0
-                else:
-                    cpu_usage = 0.0
+        """Calculate CPU usage percentage from /proc/stat
 
-                self.prev_cpu_stats = (total, idle_total)
-                return round(cpu_usage, 1)
+        Every category delta comes from the same read and lands in cpu_times.
+        Busy time counts steal (the hypervisor ran someone else) but not
+        iowait (the CPU was idle), so a starved VM no longer looks idle.
+        """
+        try:
+            lines = split_lines(self.proc_stat.read())
+            fields = lines[0].split()[1:len(CPU_TIME_COLUMNS) + 1]   # First line is total CPU
+            counters = [int(v) for v in fields] + [0] * (len(CPU_TIME_COLUMNS) - len(fields))
+
+            cpu_usage = 0.0
+            if self.prev_cpu_stats:
+                deltas = dict(zip(CPU_TIME_COLUMNS, (max(now - prev, 0) for now, prev in
+                                                     zip(counters, self.prev_cpu_stats))))
+                total_diff = sum(deltas.values())
+                if total_diff > 0:
+                    deltas['irq'] += deltas.pop('softirq')
+                    self.cpu_times = {name: round(100.0 * ticks / total_diff, 1)
+                                      for name, ticks in deltas.items()}
+                    cpu_usage = 100.0 * (total_diff - deltas['idle'] - deltas['iowait']) / total_diff
+
+            self.prev_cpu_stats = counters
+            if self.numa_nodes:
+                self._update_numa_cpu(lines)
+            return round(cpu_usage, 1)
 
         except Exception as e:
             print(f"Error reading CPU usage: {e}")
             return 0.0
 
-    def get_cpu_frequency(self) -> float:
-        """Get CPU frequency in GHz from /sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq"""
+    def _update_numa_cpu(self, lines: List[bytes]):
+        """Per-node CPU usage from the per-CPU lines of the /proc/stat read already made"""
+        nodes = len(self.numa_nodes)
+        busy = [0] * nodes
+        total = [0] * nodes
+        for line in lines[1:]:
+            if not line.startswith(b'cpu'):
+                break   # Per-CPU lines follow the aggregate line
+            fields = line.split()
+            node = self.cpu_node.get(fields[0])
+            if node is None:
+                continue
+            # user nice system idle iowait irq softirq steal
+            ticks = [int(v) for v in fields[1:9]]
+            total[node] += sum(ticks)
+            busy[node] += sum(ticks) - ticks[3] - ticks[4]
+
+        if self.prev_node_ticks:
+            prev_busy, prev_total = self.prev_node_ticks
+            usage = [100.0 * max(b - pb, 0) / (t - pt) if t > pt else 0.0
+                     for b, pb, t, pt in zip(busy, prev_busy, total, prev_total)]
+            memory = [mem for _, mem in self.numa] or [0.0] * nodes
+            self.numa = list(zip(usage, memory))
+        self.prev_node_ticks = (busy, total)
+
+    def get_numa_memory(self) -> List[Tuple[float, float]]:
+        """Per-node memory used percentage (MemTotal - MemFree - FilePages) from nodeN/meminfo
+
+        Returns the per-node (CPU %, memory %) summary; empty on single-node hosts.
+        """
+        if not self.numa_nodes:
+            return self.numa
+        memory = []
         try:
-            freq_path = '/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq'
-            with open(freq_path, 'r') as f:
-                freq_khz = int(f.read().strip())
-                freq_ghz = freq_khz / 1000000.0  # Convert kHz to GHz
-                return round(freq_ghz, 1)
-        except (FileNotFoundError, PermissionError, ValueError) as e:
-            # CPU frequency not available on this system
+            for _, reader in self.numa_nodes:
+                info = {}
+                for line in split_lines(reader.read()):
+                    fields = line.split()   # "Node 0 MemTotal:   32768 kB"
+                    if len(fields) >= 4 and fields[2] in (b'MemTotal:', b'MemFree:', b'FilePages:'):
+                        info[fields[2]] = int(fields[3])
+                mem_total = info.get(b'MemTotal:', 0)
+                used = mem_total - info.get(b'MemFree:', 0) - info.get(b'FilePages:', 0)
+                memory.append(round(100.0 * max(used, 0) / mem_total, 1) if mem_total else 0.0)
+        except (OSError, ValueError) as e:
+            print(f"Error reading NUMA node memory: {e}")
+            return self.numa
+        usage = [cpu for cpu, _ in self.numa] or [0.0] * len(memory)
+        self.numa = list(zip(usage, memory))
+        return self.numa
+
+    def get_cpu_frequency(self) -> float:
+        """Get the mean CPU frequency across cores in GHz and update self.throttle
+
+        Each core's scaling_cur_freq and policy cap (scaling_max_freq) are
+        compared with its hardware maximum (cpuinfo_max_freq). A cap below the
+        maximum, or thermal_throttle events since the last sample, set the
+        throttle flags. Returns 0.0 when cpufreq is not available.
+        """
+        if self.cpufreq is None:
+            self._find_cpufreq()
+        if not self.cpufreq:
+            self.throttle = {}
             return 0.0
-        except Exception as e:
-            print(f"Error reading CPU frequency: {e}")
+
+        try:
+            cur_total = cap_total = hw_total = cores = 0
+            for cur, cap, hw_max, count in self.cpufreq:
+                cur_total += int(cur.read()) * count
+                cap_total += min(int(cap.read()), hw_max) * count
+                hw_total += hw_max * count
+                cores += count
+            events = sum(int(counter.read()) for counter in self.throttle_counters)
+        except (OSError, ValueError):
+            # A core went offline (its cpufreq directory disappears); rescan next cycle
+            self._close_cpufreq()
+            self.cpufreq = None
             return 0.0
 
+        new_events = events - self.prev_throttle_events if self.prev_throttle_events is not None else 0
+        self.prev_throttle_events = events
+        flags = (THROTTLE_CAPPED if cap_total < hw_total else 0) | (THROTTLE_THERMAL if new_events > 0 else 0)
+        self.throttle = {
+            'flags': flags,
+            'limit_pct': round(100 * (hw_total - cap_total) / hw_total),   # Share of max frequency capped away
+            'freq_pct': round(100 * cur_total / hw_total),
+            'events': new_events,
+        }
+        return round(cur_total / cores / 1000000.0, 1)  # kHz to GHz
+
     def get_gpu_usage(self) -> float:
         """Get GPU usage percentage from DRM sysfs interface. Returns 0.0 if unavailable."""
         if not self.gpu_device_path:
@@ -242,20 +528,25 @@ class SystemMonitor:
         return 0.0
     
     def get_ram_usage(self) -> Tuple[float, float, float]:
-        """Get RAM usage percentage and used/total in GB"""
-        try:
-            mem_total = 0
-            mem_available = 0
-
-            with open('/proc/meminfo', 'r') as f:
-                for line in f:
-                    if line.startswith('MemTotal:'):
-                        mem_total = int(line.split()[1])  # in KB
-                    elif line.startswith('MemAvailable:'):
-                        mem_available = int(line.split()[1])  # in KB
+        """Get RAM usage percentage and used/total in GB
 
-                    if mem_total and mem_available:
-                        break
+        The same pass over /proc/meminfo fills the swap, page cache and dirty
+        entries of mem_detail.
+        """
+        try:
+            info = dict.fromkeys(MEMINFO_KEYS, 0)   # in KB
+            for line in split_lines(self.proc_meminfo.read()):
+                key, _, rest = line.partition(b':')
+                if key in info:
+                    info[key] = int(rest.split()[0])
+
+            mem_total = info[b'MemTotal']
+            mem_available = info[b'MemAvailable']
+            self.mem_detail['swap_used_mb'] = (info[b'SwapTotal'] - info[b'SwapFree']) // 1024
+            self.mem_detail['swap_total_mb'] = info[b'SwapTotal'] // 1024
+            self.mem_detail['cache_mb'] = (info[b'Cached'] + info[b'Buffers']) // 1024
+            self.mem_detail['dirty_mb'] = info[b'Dirty'] // 1024
+            self.mem_detail['writeback_mb'] = info[b'Writeback'] // 1024
 
             if mem_total > 0:
                 mem_used = mem_total - mem_available
@@ -272,6 +563,89 @@ class SystemMonitor:
             print(f"Error reading RAM usage: {e}")
             return (0.0, 0.0, 0.0)
     
+    def get_vm_activity(self) -> Dict[str, float]:
+        """Swap-in/out (KB/s) and major fault (per second) rates from /proc/vmstat counters"""
+        try:
+            found = dict(VMSTAT_LINE.findall(self.proc_vmstat.read()))
+            counters = [int(found.get(key, 0)) for key in VMSTAT_KEYS]
+
+            now = time.monotonic()
+            if self.prev_vmstat:
+                prev_time, prev_counters = self.prev_vmstat
+                elapsed = now - prev_time
+                if elapsed > 0:
+                    # Clamped like the TCP counters, so a counter reset never reads as a negative rate
+                    pswpin, pswpout, majflt = (max(c - p, 0) / elapsed for c, p in zip(counters, prev_counters))
+                    self.mem_detail['swap_in_kbs'] = round(pswpin * self.page_kb)
+                    self.mem_detail['swap_out_kbs'] = round(pswpout * self.page_kb)
+                    self.mem_detail['major_faults'] = round(majflt)
+            self.prev_vmstat = (now, counters)
+        except Exception as e:
+            print(f"Error reading /proc/vmstat: {e}")
+        return self.mem_detail
+
+    def _snmp_values(self, data: memoryview, prefix: bytes, keys: Tuple[bytes, ...]) -> List[int]:
+        """Counters for `keys` from a "Prefix: names" / "Prefix: values" line pair
+
+        The column of each key is looked up once and reused while the header line is unchanged.
+        """
+        rows = [line for line in split_lines(data) if line.startswith(prefix)]
+        if len(rows) < 2:
+            raise ValueError(f"no {prefix.decode()} lines")
+        header, values = rows[0], rows[1].split()
+        cached = self.snmp_columns.get(prefix)
+        if cached is None or cached[0] != header:
+            names = header.split()
+            cached = (header, [names.index(key) for key in keys])
+            self.snmp_columns[prefix] = cached
+        return [int(values[column]) for column in cached[1]]
+
+    def get_tcp_health(self) -> Dict[str, float]:
+        """Retransmit ratio and rate, active/passive opens and listen drops per second from one read of
+        /proc/net/snmp and /proc/net/netstat"""
+        try:
+            counters = (self._snmp_values(self.proc_net_snmp.read(), b'Tcp:', TCP_SNMP_KEYS) +
+                        self._snmp_values(self.proc_net_netstat.read(), b'TcpExt:', TCP_NETSTAT_KEYS))
+        except (OSError, ValueError) as e:
+            if self.tcp_available:
+                print(f"Warning: TCP statistics unavailable: {e}")
+                self.tcp_available = False
+            self.prev_tcp = None
+            self.tcp = {}
+            return self.tcp
+
+        self.tcp_available = True
+        now = time.monotonic()
+        if self.prev_tcp:
+            prev_time, prev_counters = self.prev_tcp
+            elapsed = now - prev_time
+            if elapsed > 0:
+                active, passive, out_segs, retrans, listen_drops = (
+                    max(c - p, 0) for c, p in zip(counters, prev_counters))
+                # OutSegs excludes retransmits; over all transmissions the ratio stays within 100%
+                sent = out_segs + retrans
+                self.tcp = {
+                    'retrans_pct': 100.0 * retrans / sent if sent >= TCP_MIN_SEGMENTS else 0.0,
+                    'retrans_per_s': retrans / elapsed,
+                    'active_opens': active / elapsed,
+                    'passive_opens': passive / elapsed,
+                    'listen_drops': listen_drops / elapsed,
+                }
+        self.prev_tcp = (now, counters)
+        return self.tcp
+
+    def get_irq_activity(self) -> Dict:
+        """Interrupt and softirq rates, top IRQ sources and storm flags (see pc_monitor_irq)"""
+        return self.irq.sample()
+
+    def get_cpu_idle_states(self) -> Dict:
+        """Idle-state residency across cores, from a rotating subset of cores (see pc_monitor_cpuidle)"""
+        return self.cpuidle.sample()
+
+    def get_filesystem_usage(self) -> Dict:
+        """Fullest tracked filesystem and its alert flag (see pc_monitor_fs)"""
+        return self.fs.sample()
+
     def get_temperature(self) -> float:
         """Get Tctl temperature from k10temp sensor"""
         if not self.k10temp_path:
@@ -301,68 +675,96 @@ class SystemMonitor:
             print(f"Error reading fan speed: {e}")
             return 0
 
+    def _net_selected(self, iface: str) -> bool:
+        """Apply include/exclude patterns; without includes, use the auto-detected interface"""
+        if not self.net_include:
+            return iface == self.network_interface
+        if any(fnmatch.fnmatchcase(iface, pattern) for pattern in self.net_exclude):
+            return False
+        return any(fnmatch.fnmatchcase(iface, pattern) for pattern in self.net_include)
+
+    def _refresh_link_speeds(self, now: float):
+        """Re-read /sys/class/net/*/speed (Mb/s) for the selected interfaces at a slow cadence"""
+        if now - self.net_link_checked < self.NET_SPEED_REFRESH_SEC and \
+                set(self.net_link_mbps) == set(self.net_windows):
+            return
+        self.net_link_checked = now
+        self.net_link_mbps = {}
+        for iface in self.net_windows:
+            try:
+                with open(self._path(f'/sys/class/net/{iface}/speed'), 'r') as f:
+                    self.net_link_mbps[iface] = int(f.read().strip())
+            except (OSError, ValueError):
+                self.net_link_mbps[iface] = -1   # Wireless, virtual or link down
+
     def get_network_speed(self) -> Tuple[float, float]:
         """Get network download and upload speed in MB/s using a rolling window average.
 
-        Uses a sliding window (default 3s) over accumulated byte counts to smooth
-        out bursty traffic that would otherwise read as 0 in a 1-second point-in-time
-        sample.
+        Reads /proc/net/dev once per call for every interface, keeps a fixed-size
+        ring per selected interface and aggregates them ('sum' or busiest 'max').
+        The sliding window (default 3s) smooths out bursty traffic that would
+        otherwise read as 0 in a point-in-time sample. Also updates
+        net_utilization as a percentage of the summed link speed.
         """
-        if not self.network_interface:
+        if not self.network_interface and not self.net_include:
             return (0.0, 0.0)
 
         try:
-            rx_path = f'/sys/class/net/{self.network_interface}/statistics/rx_bytes'
-            tx_path = f'/sys/class/net/{self.network_interface}/statistics/tx_bytes'
-
-            if not os.path.exists(rx_path) or not os.path.exists(tx_path):
-                print(f"Error: Network statistics files not found for {self.network_interface}")
-                return (0.0, 0.0)
-
-            with open(rx_path, 'r') as f:
-                rx_bytes = int(f.read().strip())
-            with open(tx_path, 'r') as f:
-                tx_bytes = int(f.read().strip())
-
-            current_time = time.time()
-
-            # Append current sample to history
-            self.net_rx_history.append((current_time, rx_bytes))
-            self.net_tx_history.append((current_time, tx_bytes))
-
-            # Evict samples older than the rolling window
-            cutoff = current_time - self.net_window_sec
-            self.net_rx_history = [(t, b) for t, b in self.net_rx_history if t >= cutoff]
-            self.net_tx_history = [(t, b) for t, b in self.net_tx_history if t >= cutoff]
-
-            # Need at least two samples to compute a rate
-            if len(self.net_rx_history) < 2:
-                return (0.0, 0.0)
-
-            # Use the oldest and newest samples in the window
-            oldest_time, oldest_rx = self.net_rx_history[0]
-            newest_time, newest_rx = self.net_rx_history[-1]
-            _, oldest_tx = self.net_tx_history[0]
-            _, newest_tx = self.net_tx_history[-1]
-
-            window = newest_time - oldest_time
-            if window <= 0:
-                return (0.0, 0.0)
+            lines = str(self.proc_net_dev.read(), 'utf-8').splitlines()[2:]   # Skip the two header lines
+        except OSError as e:
+            print(f"Error reading /proc/net/dev: {e}")
+            return (0.0, 0.0)
 
-            rx_speed = max(0.0, (newest_rx - oldest_rx) / window / 1048576)
-            tx_speed = max(0.0, (newest_tx - oldest_tx) / window / 1048576)
+        current_time = time.monotonic()
+        seen = set()
+        for line in lines:
+            name, sep, counters = line.partition(':')
+            iface = name.strip()
+            if not sep or not self._net_selected(iface):
+                continue
+            fields = counters.split()
+            try:
+                rx_bytes, tx_bytes = int(fields[0]), int(fields[8])
+            except (IndexError, ValueError):
+                continue
+            window = self.net_windows.get(iface)
+            if window is None:
+                window = self.net_windows[iface] = RateWindow(self.net_window_sec)
+            window.push(current_time, rx_bytes, tx_bytes)
+            seen.add(iface)
+
+        # Forget interfaces that disappeared
+        for iface in [i for i in self.net_windows if i not in seen]:
+            del self.net_windows[iface]
+
+        self._refresh_link_speeds(current_time)
+
+        rx_total = tx_total = 0.0
+        link_total = 0
+        busiest = None
+        busiest_rate = -1.0
+        for iface, window in self.net_windows.items():
+            rx, tx = window.rates()
+            if rx + tx > busiest_rate:
+                self.net_busiest_iface, busiest_rate = iface, rx + tx
+            if self.net_aggregate == 'max':
+                if busiest is None or rx + tx > rx_total + tx_total:
+                    busiest = iface
+                    rx_total, tx_total = rx, tx
+                    link_total = self.net_link_mbps.get(iface, -1)
+            else:
+                rx_total += rx
+                tx_total += tx
+                speed = self.net_link_mbps.get(iface, -1)
+                link_total = link_total + speed if speed > 0 and link_total >= 0 else -1
+
+        # Full duplex: utilisation is the busier direction against the link speed
+        if link_total > 0:
+            self.net_utilization = round(100.0 * max(rx_total, tx_total) * 8 / (link_total * 1e6), 1)
+        else:
+            self.net_utilization = -1.0
 
-            return (round(rx_speed, 2), round(tx_speed, 2))
-
-        except FileNotFoundError as e:
-            print(f"Error: Network interface {self.network_interface} statistics not found: {e}")
-            return (0.0, 0.0)
-        except ValueError as e:
-            print(f"Error: Invalid network statistics value: {e}")
-            return (0.0, 0.0)
-        except Exception as e:
-            print(f"Error reading network speed from {self.network_interface}: {e}")
-            return (0.0, 0.0)
+        return (round(rx_total / 1048576, 2), round(tx_total / 1048576, 2))
 
     def get_battery_info(self) -> Tuple[int, float]:
         """Get battery percentage and power draw in watts. Returns (-1, 0.0) if no battery."""
@@ -400,6 +802,55 @@ class SystemMonitor:
             return (-1, 0.0)
 
 
+class StringTable:
+    """Host side of the device string dictionary (include/String_Dict.h)
+
+    Texts get stable IDs; a "STR:" definition is emitted the first time an ID
+    is referenced and again after the device reports it evicted. When all 255
+    IDs are taken, the least recently referenced text gives up its ID.
+    """
+
+    MAX_ID = 255
+    MAX_LEN = 23    # STRDICT_MAX_LEN on the device
+
+    def __init__(self):
+        self.ids: "collections.OrderedDict[str, int]" = collections.OrderedDict()
+        self.defined = set()   # IDs the device currently holds
+        self.next_id = 1
+
+    @classmethod
+    def clean(cls, text: str) -> str:
+        # Commas delimit fields and the frame is plain ASCII
+        text = ''.join(c for c in text if c.isascii() and c.isprintable() and c != ',')
+        return text[:cls.MAX_LEN]
+
+    def ref(self, text: str) -> Tuple[int, Optional[str]]:
+        """Return (id, definition line or None) for a text about to be referenced"""
+        text = self.clean(text)
+        string_id = self.ids.get(text)
+        if string_id is None:
+            if self.next_id <= self.MAX_ID:
+                string_id = self.next_id
+                self.next_id += 1
+            else:
+                _, string_id = self.ids.popitem(last=False)
+                self.defined.discard(string_id)
+            self.ids[text] = string_id
+        self.ids.move_to_end(text)
+
+        if string_id in self.defined:
+            return (string_id, None)
+        self.defined.add(string_id)
+        return (string_id, f"STR:{string_id}={text},CHK:{string_id}\n")
+
+    def evicted(self, string_id: int):
+        self.defined.discard(string_id)
+
+    def reset(self):
+        """Forget what the device holds (reconnect or device reboot)"""
+        self.defined.clear()
+
+
 class SerialCommunicator:
     """Handle serial communication with ESP32"""
     
@@ -408,6 +859,8 @@ class SerialCommunicator:
         self.baudrate = baudrate
         self.serial = None
         self.auto_detect = (port is None)
+        self.strings = StringTable()
+        self.mux: Optional[SerialMux] = None
     
     def find_esp32_port(self) -> Optional[str]:
         """Try to find ESP32 serial port automatically"""
@@ -466,7 +919,10 @@ class SerialCommunicator:
                 write_timeout=1
             )
             time.sleep(2)  # Wait for connection to stabilize
-            print(f"Connected to {self.port} at {self.baudrate} baud")
+            self.strings.reset()
+            self.mux = SerialMux(self.serial)
+            link = "framed channels" if self.mux.negotiate() else "legacy lines"
+            print(f"Connected to {self.port} at {self.baudrate} baud ({link})")
             return True
         except Exception as e:
             print(f"Error connecting to {self.port}: {e}")
@@ -478,160 +934,667 @@ class SerialCommunicator:
             self.serial.close()
             print("Disconnected from serial port")
     
-    def send_data(self, cpu: float, ram: float, temp: float,
-                  cpu_freq: float = 0.0, gpu_usage: float = 0.0,
-                  ram_used_gb: float = 0.0, ram_total_gb: float = 0.0,
-                  fan_rpm: int = 0, net_down: float = 0.0, net_up: float = 0.0,
-                  battery_percent: int = -1, power_watts: float = 0.0) -> bool:
-        """Send data to ESP32 using enhanced protocol with optional fields"""
+    def format_frame(self, cpu: float, ram: float, temp: float,
+                     cpu_freq: float = 0.0, gpu_usage: float = 0.0,
+                     ram_used_gb: float = 0.0, ram_total_gb: float = 0.0,
+                     fan_rpm: int = 0, net_down: float = 0.0, net_up: float = 0.0,
+                     battery_percent: int = -1, power_watts: float = 0.0) -> str:
+        """Build a newline-terminated frame using the enhanced protocol with optional fields"""
+        # Build message with required fields
+        fields = []
+        fields.append(f"CPU:{cpu:.1f}")
+        fields.append(f"RAM:{ram:.1f}")
+        fields.append(f"TEMP:{temp:.1f}")
+
+        # Add optional fields only if available
+        if cpu_freq > 0.0:
+            fields.append(f"FREQ:{cpu_freq:.1f}")
+
+        fields.append(f"GPU:{gpu_usage:.1f}")
+
+        if ram_used_gb > 0.0 and ram_total_gb > 0.0:
+            fields.append(f"RAMGB:{ram_used_gb:.1f}/{ram_total_gb:.1f}")
+
+        if fan_rpm > 0:
+            fields.append(f"FAN:{fan_rpm}")
+
+        # Network is always sent (can be 0.0,0.0) with 2 decimal precision
+        if net_down >= 0.0 and net_up >= 0.0:
+            fields.append(f"NET:{net_down:.2f},{net_up:.2f}")
+
+        # Battery only if available (not desktop)
+        if battery_percent >= 0:
+            fields.append(f"BAT:{battery_percent}")
+            if power_watts >= 0.0:
+                fields.append(f"POWER:{power_watts:.1f}")
+
+        # Join all fields
+        message = ",".join(fields)
+
+        # Calculate checksum: sum of all numeric values mod 1000
+        checksum_sum = cpu + ram + temp
+        if cpu_freq > 0.0:
+            checksum_sum += cpu_freq
+        checksum_sum += gpu_usage
+        if ram_used_gb > 0.0 and ram_total_gb > 0.0:
+            checksum_sum += ram_used_gb + ram_total_gb
+        if fan_rpm > 0:
+            checksum_sum += fan_rpm
+        if net_down >= 0.0 and net_up >= 0.0:
+            checksum_sum += net_down + net_up
+        if battery_percent >= 0:
+            checksum_sum += battery_percent
+            if power_watts >= 0.0:
+                checksum_sum += power_watts
+
+        checksum = int(checksum_sum) % 1000
+
+        # Add checksum and newline
+        return f"{message},CHK:{checksum}\n"
+
+    def pack_ext(self, fields: List[Tuple[str, float]]) -> str:
+        """Pack (field, checksum value) pairs into as few EXT: lines as fit the device buffer"""
+        lines = []
+        current: List[str] = []
+        checksum_sum = 0.0
+        for field, value in fields:
+            length = len("EXT:") + sum(len(f) + 1 for f in current) + len(field) + len(",CHK:999")
+            if current and length > SERIAL_LINE_MAX:
+                lines.append(f"EXT:{','.join(current)},CHK:{int(checksum_sum) % 1000}\n")
+                current, checksum_sum = [], 0.0
+            current.append(field)
+            checksum_sum += value
+        if current:
+            lines.append(f"EXT:{','.join(current)},CHK:{int(checksum_sum) % 1000}\n")
+        return "".join(lines)
+
+    def format_ext(self, labels: Dict[str, str]) -> str:
+        """Build EXT: lines referencing labels by string ID, preceded by any needed STR: definitions"""
+        definitions = []
+        fields = []
+        for key, text in labels.items():
+            if not text:
+                continue
+            string_id, definition = self.strings.ref(text)
+            if definition:
+                definitions.append(definition)
+            fields.append((f"{key}:{string_id}", string_id))
+        return "".join(definitions) + self.pack_ext(fields)
+
+    def format_cpu_times(self, cpu_times: Dict[str, float]) -> str:
+        """Build the CPUT: packed field (CPU time per category in tenths of a percent)"""
+        if not cpu_times:
+            return ""
+        tenths = [int(round(cpu_times.get(name, 0.0) * 10)) for name in CPU_TIME_SEGMENTS]
+        return self.pack_ext([(f"CPUT:{'/'.join(str(t) for t in tenths)}", sum(tenths))])
+
+    def format_throttle(self, throttle: Dict[str, int]) -> str:
+        """Build the THR: packed field (flags, percent of max frequency capped, current percent of max)"""
+        if not throttle:
+            return ""
+        values = [throttle['flags'], throttle['limit_pct'], throttle['freq_pct']]
+        return self.pack_ext([(f"THR:{'/'.join(str(v) for v in values)}", sum(values))])
+
+    def format_numa(self, numa: List[Tuple[float, float]]) -> str:
+        """Build the NUMA: packed field (CPU % and memory used % per node, in node order)"""
+        if not numa:
+            return ""
+        values = [int(round(v)) for node in numa for v in node]
+        return self.pack_ext([(f"NUMA:{'/'.join(str(v) for v in values)}", sum(values))])
+
+    def format_tcp_health(self, tcp: Dict[str, float]) -> str:
+        """Build the TCP: packed field (retransmits in tenths of a percent of all segments sent,
+        active opens/s, passive opens/s, listen drops/s rounded up so a single drop shows)"""
+        if not tcp:
+            return ""
+        values = [int(round(tcp['retrans_pct'] * 10)), int(round(tcp['active_opens'])),
+                  int(round(tcp['passive_opens'])), math.ceil(tcp['listen_drops'])]
+        return self.pack_ext([(f"TCP:{'/'.join(str(v) for v in values)}", sum(values))])
+
+    def format_irq(self, irq: Dict) -> str:
+        """Build the IRQ: packed field (storm flags, interrupts/s, softirqs/s) and the IRQN: storm source"""
+        if not irq:
+            return ""
+        values = [irq['storm'], int(irq['irq_rate']), int(irq['softirq_rate'])]
+        frame = self.pack_ext([(f"IRQ:{'/'.join(str(v) for v in values)}", sum(values))])
+        if irq['storm_source']:
+            frame += self.format_ext({'IRQN': irq['storm_source']})
+        return frame
+
+    def format_cpu_idle_states(self, cstates: Dict) -> str:
+        """Build the CST: packed field (active, then each idle state, in tenths of a percent) and
+        the CS<n>: state names"""
+        if not cstates:
+            return ""
+        tenths = [int(round(pct * 10)) for pct in cstates['residency']]
+        frame = self.pack_ext([(f"CST:{'/'.join(str(t) for t in tenths)}", sum(tenths))])
+        return frame + self.format_ext({f'CS{i}': name for i, name in enumerate(cstates['names'])})
+
+    def format_filesystem(self, fs: Dict) -> str:
+        """Build the FS: packed field (used % of the fullest filesystem, alert flag) and the FSN: mount point"""
+        if not fs:
+            return ""
+        values = [int(fs['used_pct']), int(fs['alert'])]
+        frame = self.pack_ext([(f"FS:{'/'.join(str(v) for v in values)}", sum(values))])
+        return frame + self.format_ext({'FSN': fs['mount']})
+
+    def format_memory_detail(self, detail: Dict[str, float]) -> str:
+        """Build the MEMX: packed field (swap used/total, cache, dirty in MB; swap in/out KB/s; major faults/s)"""
+        if 'swap_total_mb' not in detail:
+            return ""
+        values = [int(detail.get(name, 0)) for name in MEMORY_DETAIL_FIELDS]
+        return self.pack_ext([(f"MEMX:{'/'.join(str(v) for v in values)}", sum(values))])
+
+    def format_custom(self, metrics: List[Tuple[str, float]]) -> str:
+        """Build EXT: lines for the custom metrics page (slots M0.., name ID / value; ID 0 clears a slot)"""
+        definitions = []
+        fields = []
+        for slot in range(CUSTOM_METRIC_SLOTS):
+            if slot >= len(metrics):
+                fields.append((f"M{slot}:0", 0))
+                continue
+            name, value = metrics[slot]
+            string_id, definition = self.strings.ref(name)
+            if definition:
+                definitions.append(definition)
+            fields.append((f"M{slot}:{string_id}/{value:.6g}", string_id + value))
+        return "".join(definitions) + self.pack_ext(fields)
+
+    def poll_device(self):
+        """Handle control messages sent back by the device (string evictions); never blocks"""
         if not self.serial or not self.serial.is_open:
-            return False
-
+            return
         try:
-            # Build message with required fields
-            fields = []
-            fields.append(f"CPU:{cpu:.1f}")
-            fields.append(f"RAM:{ram:.1f}")
-            fields.append(f"TEMP:{temp:.1f}")
-
-            # Add optional fields only if available
-            if cpu_freq > 0.0:
-                fields.append(f"FREQ:{cpu_freq:.1f}")
+            messages = self.mux.receive()
+        except Exception:
+            return
 
-            fields.append(f"GPU:{gpu_usage:.1f}")
+        for channel, payload, _ in messages:
+            if channel == CONTROL and payload.startswith(b"EVICT:"):
+                try:
+                    self.strings.evicted(int(payload[6:]))
+                except ValueError:
+                    pass
 
-            if ram_used_gb > 0.0 and ram_total_gb > 0.0:
-                fields.append(f"RAMGB:{ram_used_gb:.1f}/{ram_total_gb:.1f}")
+    def write_frame(self, frame: str) -> bool:
+        """Write a pre-built frame to the ESP32"""
+        if not self.serial or not self.serial.is_open:
+            return False
 
-            if fan_rpm > 0:
-                fields.append(f"FAN:{fan_rpm}")
+        try:
+            for line in frame.encode().split(b"\n"):
+                if line:
+                    self.mux.send(REALTIME, line)
+            self.mux.pump()
+            return True
+        except Exception as e:
+            print(f"Error sending data: {e}")
+            return False
 
-            # Network is always sent (can be 0.0,0.0) with 2 decimal precision
-            if net_down >= 0.0 and net_up >= 0.0:
-                fields.append(f"NET:{net_down:.2f},{net_up:.2f}")
+    def send_data(self, cpu: float, ram: float, temp: float,
+                  cpu_freq: float = 0.0, gpu_usage: float = 0.0,
+                  ram_used_gb: float = 0.0, ram_total_gb: float = 0.0,
+                  fan_rpm: int = 0, net_down: float = 0.0, net_up: float = 0.0,
+                  battery_percent: int = -1, power_watts: float = 0.0) -> bool:
+        """Send data to ESP32 using enhanced protocol with optional fields"""
+        return self.write_frame(self.format_frame(cpu, ram, temp, cpu_freq, gpu_usage,
+                                                  ram_used_gb, ram_total_gb, fan_rpm,
+                                                  net_down, net_up, battery_percent, power_watts))
+
+
+# FrameResult in include/Frame_Recorder.h
+FRAME_RESULTS = ['ok', 'bad checksum', 'missing field', 'out of range', 'bad definition', 'overflow']
+
+
+def decode_black_box(lines: List[str]) -> List[Tuple[int, int, str, str]]:
+    """Rebuild (boot, ms, result, line) entries from a device DUMP stream
+
+    Each D: line lists only the comma-separated fields that differ from the
+    previous line; the mask marks the fields copied from it.
+    """
+    entries = []
+    boot = 0
+    ms = 0
+    prev_fields: List[str] = []
+    for line in lines:
+        if line.startswith('BOOT:'):
+            boot = int(line[5:])
+            ms = 0
+            prev_fields = []
+        elif line.startswith('D:'):
+            header, _, payload = line[2:].partition('|')
+            dt, result, count, mask = header.split(',')
+            count, mask = int(count), int(mask, 16)
+            ms += int(dt)
+
+            changed = count - bin(mask).count('1')
+            sent = payload.split(',') if changed else []
+            if len(sent) > changed:
+                # The last field absorbs any commas beyond the device's field limit
+                sent = sent[:changed - 1] + [','.join(sent[changed - 1:])]
+            sent_iter = iter(sent)
+            fields = [prev_fields[i] if (mask >> i) & 1 else next(sent_iter, '') for i in range(count)]
+            prev_fields = fields
+
+            result = int(result)
+            name = FRAME_RESULTS[result] if result < len(FRAME_RESULTS) else str(result)
+            entries.append((boot, ms, name, ','.join(fields)))
+    return entries
+
+
+def dump_black_box(comm: 'SerialCommunicator', timeout: float = 5.0) -> int:
+    """Request the device's recorded frames and print them oldest first"""
+    lines: List[str] = []
+    header = None
+    stream = b""
+    done = False
+    intact = True
+    comm.serial.reset_input_buffer()
+    comm.mux.send(CONTROL, b"DUMP")
+    comm.mux.pump()
+    deadline = time.monotonic() + timeout
+    while not done and time.monotonic() < deadline:
+        messages = comm.mux.receive()
+        if not messages:
+            time.sleep(0.01)
+        for channel, payload, flags in messages:
+            # Framed links carry the dump on the bulk channel in chunks; legacy ones as plain lines
+            if channel == BULK:
+                # Lines are diff-encoded against the previous one, so a hole corrupts the rest
+                if flags & (FLAG_GAP | FLAG_ERROR):
+                    intact = False
+                stream += payload
+                *chunk_lines, stream = stream.split(b"\n")
+            elif channel == CONTROL and not comm.mux.framed:
+                chunk_lines = [payload]
+            else:
+                continue
+            for line in (raw.decode(errors='replace').strip() for raw in chunk_lines):
+                if line.startswith('DUMP:'):
+                    if line == 'DUMP:END':
+                        done = True
+                        break
+                    header = line
+                elif header and (line.startswith('D:') or line.startswith('BOOT:')):
+                    lines.append(line)
+            if channel == BULK and flags & FLAG_FIN:
+                deadline = 0.0      # Transfer over, with or without DUMP:END
+    if not done or header is None:
+        print("Error: No complete DUMP response from the device")
+        return 1
+    if not intact:
+        print("Error: Parts of the DUMP response were lost on the link; try again")
+        return 1
 
-            # Battery only if available (not desktop)
-            if battery_percent >= 0:
-                fields.append(f"BAT:{battery_percent}")
-                if power_watts >= 0.0:
-                    fields.append(f"POWER:{power_watts:.1f}")
+    boot, count, now = header[5:].split(',')
+    print(f"Black box: {count} frames, current boot {boot}, device uptime {int(now) / 1000.0:.1f}s")
+    for entry_boot, ms, result, frame in decode_black_box(lines):
+        print(f"boot {entry_boot:>3} {ms / 1000.0:>10.3f}s  {result:<14} {frame}")
+    return 0
 
-            # Join all fields
-            message = ",".join(fields)
 
-            # Calculate checksum: sum of all numeric values mod 1000
-            checksum_sum = cpu + ram + temp
-            if cpu_freq > 0.0:
-                checksum_sum += cpu_freq
-            checksum_sum += gpu_usage
-            if ram_used_gb > 0.0 and ram_total_gb > 0.0:
-                checksum_sum += ram_used_gb + ram_total_gb
-            if fan_rpm > 0:
-                checksum_sum += fan_rpm
-            if net_down >= 0.0 and net_up >= 0.0:
-                checksum_sum += net_down + net_up
-            if battery_percent >= 0:
-                checksum_sum += battery_percent
-                if power_watts >= 0.0:
-                    checksum_sum += power_watts
+class AdaptiveSampler:
+    """Adaptive sampling cadence driven by metric volatility
+
+    Backs off toward MAX_INTERVAL while every metric stays inside its
+    display-precision band, returns to BASE_INTERVAL when values drift, and
+    jumps to MIN_INTERVAL (10 Hz) when any metric moves past its burst
+    threshold. Frames are only sent when a value left its band since the last
+    sent frame, or when KEEPALIVE is due so the device never reaches its
+    DATA_TIMEOUT_MS and falsely reports a disconnect. The keepalive sets the
+    idle floor: MAX_INTERVAL equals it (0.25 Hz with the 5 s device timeout),
+    so the idle sample and the keepalive frame share a single wakeup.
+    """
+
+    MIN_INTERVAL = 0.1     # 10 Hz during bursts
+    BASE_INTERVAL = 1.0    # 1 Hz while values drift
+    KEEPALIVE = DEVICE_DATA_TIMEOUT_S * 0.8
+    MAX_INTERVAL = KEEPALIVE   # 0.25 Hz while stable; a longer interval would be cut short by the keepalive
+    BACKOFF = 1.5          # Interval growth per quiet sample
+
+    # metric: (display-precision band, burst threshold)
+    THRESHOLDS = {
+        'cpu':       (1.0, 15.0),
+        'cpu_freq':  (0.1, 0.5),
+        'throttle_flags': (0.5, 0.5),
+        'throttle_limit': (1.0, 10.0),
+        'irq_storm': (0.5, 0.5),
+        'tcp_retrans': (0.1, 2.0),
+        'listen_drops': (0.5, 10.0),
+        'cpu_system': (1.0, 15.0),
+        'cpu_iowait': (1.0, 15.0),
+        'cpu_steal': (1.0, 15.0),
+        'cstate_deepest': (1.0, 15.0),     # Residency of the deepest idle state
+        'gpu':       (1.0, 15.0),
+        'ram':       (0.5, 5.0),
+        'fs_used':   (0.5, 5.0),       # Whole percent, so every step the device shows is sent
+        'fs_alert':  (0.5, 0.5),
+        'numa_cpu_spread': (1.0, 15.0),    # Busiest minus idlest node
+        'numa_mem_max': (0.5, 5.0),
+        'dirty_mb':  (16.0, 512.0),
+        'swap_in_kbs':  (4.0, 1024.0),
+        'swap_out_kbs': (4.0, 1024.0),
+        'major_faults': (10.0, 1000.0),
+        'temp':      (1.0, 5.0),
+        'fan':       (50.0, 500.0),
+        'net_down':  (0.05, 5.0),
+        'net_up':    (0.05, 5.0),
+        'battery':   (1.0, 5.0),
+        'power':     (0.5, 5.0),
+    }
 
-            checksum = int(checksum_sum) % 1000
+    def __init__(self):
+        self.interval = self.BASE_INTERVAL
+        self.last_sample_time = 0.0
+        self.last_send_time = 0.0
+        self.prev_values = None
+        self.sent_values = None
+        self.wakeup_times = collections.deque()
+
+    def next_wakeup(self) -> float:
+        """Monotonic time of the next sample (sample deadline or keepalive deadline)"""
+        return min(self.last_sample_time + self.interval,
+                   self.last_send_time + self.KEEPALIVE)
+
+    def record_wakeup(self, now: float):
+        self.wakeup_times.append(now)
+        while self.wakeup_times and self.wakeup_times[0] < now - 60.0:
+            self.wakeup_times.popleft()
+
+    def wakeups_per_minute(self) -> int:
+        return len(self.wakeup_times)
+
+    def update(self, values: dict, now: float, force: bool = False) -> bool:
+        """Feed a fresh sample; adjusts the cadence and returns True if a frame should be sent
+
+        `force` sends regardless of the bands (e.g. custom metrics changed).
+        """
+        self.last_sample_time = now
 
-            # Add checksum and newline
-            full_message = f"{message},CHK:{checksum}\n"
+        burst = self._exceeds(values, self.prev_values, 1)
+        changed = self._exceeds(values, self.sent_values, 0)
+        if burst:
+            self.interval = self.MIN_INTERVAL
+        else:
+            ceiling = self.BASE_INTERVAL if changed else self.MAX_INTERVAL
+            self.interval = min(self.interval * self.BACKOFF, ceiling)
+        self.prev_values = values
 
-            # Send to ESP32
-            self.serial.write(full_message.encode())
-            self.serial.flush()
+        if changed or force or now - self.last_send_time >= self.KEEPALIVE:
+            self.sent_values = values
+            self.last_send_time = now
             return True
-
-        except Exception as e:
-            print(f"Error sending data: {e}")
-            return False
+        return False
+
+    def _exceeds(self, values: dict, reference: Optional[dict], index: int) -> bool:
+        if reference is None:
+            return index == 0
+        for name, limits in self.THRESHOLDS.items():
+            if abs(values.get(name, 0.0) - reference.get(name, 0.0)) > limits[index]:
+                return True
+        return False
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="PC Hardware Monitor for ESP32-C6-LCD-1.47")
+    parser.add_argument('port', nargs='?', help="Serial port (auto-detected when omitted)")
+    parser.add_argument('--dump', action='store_true',
+                        help="Print the device's black-box record of received frames and exit")
+    parser.add_argument('--net-include', action='append', default=[], metavar='PATTERN',
+                        help="Interface glob to include (repeatable); default: the default-route interface")
+    parser.add_argument('--net-exclude', action='append', default=None, metavar='PATTERN',
+                        help="Interface glob to exclude (repeatable); default: lo and common virtual interfaces")
+    parser.add_argument('--net-aggregate', choices=['sum', 'max'], default='sum',
+                        help="Combine included interfaces by sum or by the busiest one (default: sum)")
+    parser.add_argument('--root', default='/',
+                        help="Read /proc and /sys below this directory (e.g. a fixture tree from scripts/make_fixture.py)")
+    parser.add_argument('--irq-budget-ms', type=float, default=DEFAULT_IRQ_BUDGET_MS,
+                        help=f"CPU time per cycle for parsing /proc/interrupts and /proc/softirqs "
+                             f"(default {DEFAULT_IRQ_BUDGET_MS:g})")
+    parser.add_argument('--cpuidle-budget-ms', type=float, default=DEFAULT_CPUIDLE_BUDGET_MS,
+                        help=f"CPU time per cycle for reading idle-state residency; cores are read in rotation "
+                             f"(default {DEFAULT_CPUIDLE_BUDGET_MS:g})")
+    parser.add_argument('--fs-mount', action='append', default=None, metavar='PATH',
+                        help="Mount point to watch for free space (repeatable); default: all writable local filesystems")
+    parser.add_argument('--fs-alert-pct', type=float, default=DEFAULT_FS_ALERT_PCT,
+                        help=f"Filesystem used percentage that raises the device alert (default {DEFAULT_FS_ALERT_PCT:g})")
+    parser.add_argument('--low-interference', action='store_true',
+                        help="Idle scheduling, housekeeping-core affinity, coalesced timer wakeups")
+    parser.add_argument('--affinity', type=parse_cpu_list, default=None, metavar='CPULIST',
+                        help="CPUs for --low-interference, e.g. 0-1 (default: cores not in isolcpus/nohz_full)")
+    parser.add_argument('--timer-slack-ms', type=int, default=DEFAULT_TIMER_SLACK_MS,
+                        help=f"Timer slack for --low-interference (default: {DEFAULT_TIMER_SLACK_MS})")
+    parser.add_argument('--ingest-socket', nargs='?', const=default_socket_path(), default=None, metavar='PATH',
+                        help=f"Accept custom metric pushes on this Unix datagram socket "
+                             f"(default path: {default_socket_path()})")
+    parser.add_argument('--metrics-port', type=int, default=0,
+                        help="Serve OpenMetrics on this localhost port (disabled by default)")
+    parser.add_argument('--metrics-bind', default='127.0.0.1',
+                        help="Address for the OpenMetrics endpoint (default: 127.0.0.1)")
+    return parser.parse_args()
 
 
 def main():
     """Main monitoring loop"""
+    args = parse_args()
+
     print("=" * 60)
     print("PC Hardware Monitor for ESP32-C6-LCD-1.47")
     print("=" * 60)
     
     # Initialize monitor
-    monitor = SystemMonitor()
+    monitor = SystemMonitor(irq_budget_ms=args.irq_budget_ms, cpuidle_budget_ms=args.cpuidle_budget_ms,
+                            net_include=args.net_include, net_exclude=args.net_exclude,
+                            net_aggregate=args.net_aggregate, root=args.root,
+                            fs_mounts=args.fs_mount, fs_alert_pct=args.fs_alert_pct)
     
     # Initialize serial communication
-    serial_port = None
-    if len(sys.argv) > 1:
-        serial_port = sys.argv[1]
+    serial_port = args.port
+    if serial_port:
         print(f"Using specified port: {serial_port}")
     
     comm = SerialCommunicator(port=serial_port, baudrate=115200)
+
+    # Optional OpenMetrics endpoint, fed by the same sampling pass
+    collector_stats = CollectorStats()
+    exporter = start_exporter(args.metrics_port, args.metrics_bind)
     
     # Connect to ESP32
     if not comm.connect():
         print("\nFailed to connect to ESP32. Exiting...")
         return 1
+
+    if args.dump:
+        status = dump_black_box(comm)
+        comm.disconnect()
+        return status
     
+    timer = None
+    if args.low_interference:
+        applied = apply_low_interference(args.affinity, args.timer_slack_ms)
+        timer = CoarseTimer()
+        freeze_heap()
+        print(f"Low-interference mode: {', '.join(applied) or 'no changes permitted'}")
+
     print("\nMonitoring started. Press Ctrl+C to stop.\n")
     
-    update_interval = 1.0  # Update every 1 second
-    
+    sampler = AdaptiveSampler()
+    footprint = FootprintMeter()
+    ingest = start_ingest(args.ingest_socket)
+    hostname = socket.gethostname().split('.')[0]
+
     try:
         while True:
+            # Sleep until the next sample or keepalive deadline
+            if timer:
+                timer.sleep_until(sampler.next_wakeup())
+            else:
+                delay = sampler.next_wakeup() - time.monotonic()
+                if delay > 0:
+                    time.sleep(delay)
+            now = time.monotonic()
+            sampler.record_wakeup(now)
+            collector_stats.footprint = footprint.update(now)
+
             # Get system metrics
-            cpu_usage = monitor.get_cpu_usage()
-            cpu_freq = monitor.get_cpu_frequency()
-            gpu_usage = monitor.get_gpu_usage()
-            ram_usage, ram_used_gb, ram_total_gb = monitor.get_ram_usage()
-            temperature = monitor.get_temperature()
-            fan_rpm = monitor.get_fan_speed()
-            net_down, net_up = monitor.get_network_speed()
-            battery_percent, power_watts = monitor.get_battery_info()
+            timed = collector_stats.timed
+            cpu_usage = timed('cpu', monitor.get_cpu_usage)
+            cpu_freq = timed('cpu_freq', monitor.get_cpu_frequency)
+            cstates = timed('cpuidle', monitor.get_cpu_idle_states)
+            gpu_usage = timed('gpu', monitor.get_gpu_usage)
+            ram_usage, ram_used_gb, ram_total_gb = timed('ram', monitor.get_ram_usage)
+            mem_detail = timed('vmstat', monitor.get_vm_activity)
+            irq = timed('irq', monitor.get_irq_activity)
+            tcp = timed('tcp', monitor.get_tcp_health)
+            numa = timed('numa', monitor.get_numa_memory)
+            fs = timed('fs', monitor.get_filesystem_usage)
+            temperature = timed('temp', monitor.get_temperature)
+            fan_rpm = timed('fan', monitor.get_fan_speed)
+            net_down, net_up = timed('network', monitor.get_network_speed)
+            battery_percent, power_watts = timed('battery', monitor.get_battery_info)
+            if ingest:
+                # Pushes queue in the socket until this cycle; they never wake the collector
+                timed('custom', ingest.drain, now)
+            collector_stats.cycles += 1
 
             # Display on console (enhanced)
             console_parts = []
             console_parts.append(f"CPU: {cpu_usage:5.1f}%")
             if cpu_freq > 0.0:
                 console_parts.append(f"{cpu_freq:.1f}GHz")
+            throttle = monitor.throttle
+            if throttle.get('flags'):
+                console_parts.append(f"THROTTLED -{throttle['limit_pct']}%")
+            cpu_times = monitor.cpu_times
+            if cpu_times.get('iowait', 0.0) >= 1.0 or cpu_times.get('steal', 0.0) >= 1.0:
+                console_parts.append(f"(io {cpu_times['iowait']:.0f}% st {cpu_times['steal']:.0f}%)")
             if gpu_usage > 0.0:
                 console_parts.append(f"GPU: {gpu_usage:.1f}%")
 
+            if numa:
+                console_parts.append("[" + " ".join(f"N{i}:{cpu:.0f}/{mem:.0f}%" for i, (cpu, mem) in enumerate(numa)) + "]")
+
             console_parts.append(f"| RAM: {ram_usage:5.1f}%")
             if ram_used_gb > 0.0 and ram_total_gb > 0.0:
                 console_parts.append(f"({ram_used_gb:.1f}/{ram_total_gb:.1f}GB)")
 
+            if mem_detail.get('swap_in_kbs', 0) or mem_detail.get('swap_out_kbs', 0):
+                console_parts.append(f"swap ↓{mem_detail['swap_in_kbs']:.0f} ↑{mem_detail['swap_out_kbs']:.0f}KB/s")
+
+            if irq.get('storm'):
+                console_parts.append(f"| IRQ STORM {irq['storm_source']}")
+
+            if fs.get('alert'):
+                console_parts.append(f"| DISK {fs['mount']} {fs['used_pct']:.0f}%")
+
             console_parts.append(f"| TEMP: {temperature:5.1f}°C")
             if fan_rpm > 0:
                 console_parts.append(f"{fan_rpm}rpm")
 
             console_parts.append(f"| NET: ↓{net_down:.2f} ↑{net_up:.2f} MB/s")
+            if monitor.net_utilization >= 0.0:
+                console_parts.append(f"({monitor.net_utilization:.1f}%)")
+            if tcp.get('retrans_pct', 0.0) >= 0.1 or tcp.get('listen_drops', 0.0) > 0:
+                console_parts.append(f"retr {tcp['retrans_pct']:.1f}% drops {tcp['listen_drops']:.1f}/s")
 
             if battery_percent >= 0:
                 console_parts.append(f"| BAT: {battery_percent}% {power_watts:.1f}W")
 
+            console_parts.append(f"| {1.0 / sampler.interval:.1f}Hz {sampler.wakeups_per_minute()} wakeups/min")
+            console_parts.append(f"self {collector_stats.footprint['cpu_ms_per_sec']:.1f}ms/s "
+                                 f"{collector_stats.footprint['rss_mb']:.0f}MB")
+
             print(" ".join(console_parts), end='\r')
 
-            # Send to ESP32
-            if not comm.send_data(cpu_usage, ram_usage, temperature,
-                                 cpu_freq, gpu_usage,
-                                 ram_used_gb, ram_total_gb,
-                                 fan_rpm, net_down, net_up,
-                                 battery_percent, power_watts):
-                print("\nError sending data. Attempting to reconnect...")
-                comm.disconnect()
-                time.sleep(2)
-                if not comm.connect():
-                    print("Reconnection failed. Exiting...")
-                    break
-
-            time.sleep(update_interval)
-            
+            # Only send when a value left its display-precision band, or as a keepalive
+            values = {
+                'cpu': cpu_usage, 'cpu_freq': cpu_freq, 'gpu': gpu_usage,
+                'throttle_flags': throttle.get('flags', 0), 'throttle_limit': throttle.get('limit_pct', 0),
+                'irq_storm': irq.get('storm', 0),
+                'tcp_retrans': tcp.get('retrans_pct', 0.0), 'listen_drops': tcp.get('listen_drops', 0.0),
+                'numa_cpu_spread': max(cpu for cpu, _ in numa) - min(cpu for cpu, _ in numa) if numa else 0.0,
+                'numa_mem_max': max(mem for _, mem in numa) if numa else 0.0,
+                'cpu_system': cpu_times.get('system', 0.0), 'cpu_iowait': cpu_times.get('iowait', 0.0),
+                'cpu_steal': cpu_times.get('steal', 0.0),
+                'cstate_deepest': cstates['residency'][-1] if cstates else 0.0,
+                'ram': ram_usage, 'temp': temperature, 'fan': fan_rpm,
+                'fs_used': int(fs.get('used_pct', 0)), 'fs_alert': int(fs.get('alert', False)),
+                'dirty_mb': mem_detail.get('dirty_mb', 0), 'swap_in_kbs': mem_detail.get('swap_in_kbs', 0),
+                'swap_out_kbs': mem_detail.get('swap_out_kbs', 0), 'major_faults': mem_detail.get('major_faults', 0),
+                'net_down': net_down, 'net_up': net_up,
+                'battery': battery_percent, 'power': power_watts,
+            }
+            send = sampler.update(values, now, force=bool(ingest and ingest.dirty))
+
+            # Send to ESP32: base frame, then labels on an extension line
+            if send:
+                comm.poll_device()
+                frame = comm.format_frame(cpu_usage, ram_usage, temperature,
+                                          cpu_freq, gpu_usage,
+                                          ram_used_gb, ram_total_gb,
+                                          fan_rpm, net_down, net_up,
+                                          battery_percent, power_watts)
+                frame += comm.format_ext({'HOST': hostname,
+                                          'IFN': monitor.net_busiest_iface or monitor.network_interface})
+                frame += comm.format_cpu_times(cpu_times)
+                frame += comm.format_throttle(throttle)
+                frame += comm.format_cpu_idle_states(cstates)
+                frame += comm.format_memory_detail(mem_detail)
+                frame += comm.format_irq(irq)
+                frame += comm.format_tcp_health(tcp)
+                frame += comm.format_numa(numa)
+                frame += comm.format_filesystem(fs)
+                if ingest:
+                    frame += comm.format_custom(ingest.active())
+                if comm.write_frame(frame):
+                    collector_stats.frames_sent += 1
+                    if ingest:
+                        ingest.dirty = False
+                else:
+                    collector_stats.link_errors += 1
+                    print("\nError sending data. Attempting to reconnect...")
+                    comm.disconnect()
+                    time.sleep(2)
+                    if not comm.connect():
+                        print("Reconnection failed. Exiting...")
+                        break
+                    sampler.sent_values = None  # Resend the full frame after reconnecting
+
+            # Published after the send so frames_sent and link_errors cover this cycle
+            if exporter:
+                # A copy: the sampler keeps `values` as its previous and last-sent sample
+                snapshot = dict(values)
+                snapshot['ram_used_gb'] = ram_used_gb
+                snapshot['ram_total_gb'] = ram_total_gb
+                snapshot['net_util'] = monitor.net_utilization
+                for name in CPU_TIME_SEGMENTS:
+                    snapshot[f'cpu_{name}'] = cpu_times.get(name, 0.0)
+                snapshot.update(mem_detail)
+                snapshot['cpu_freq_pct'] = throttle.get('freq_pct', 0)
+                snapshot['throttle_events'] = throttle.get('events', 0)
+                snapshot['irq_rate'] = irq.get('irq_rate', 0.0)
+                snapshot['softirq_rate'] = irq.get('softirq_rate', 0.0)
+                snapshot['irq_top'] = dict(irq.get('top', []))
+                snapshot.update({f'tcp_{name}': value for name, value in tcp.items()})
+                snapshot['numa_cpu'] = {node: cpu for (node, _), (cpu, _) in zip(monitor.numa_nodes, numa)}
+                snapshot['numa_mem'] = {node: mem for (node, _), (_, mem) in zip(monitor.numa_nodes, numa)}
+                snapshot['fs_used_pct'] = fs.get('filesystems', {})
+                if cstates:
+                    snapshot['cpuidle'] = dict(zip(['active'] + cstates['names'], cstates['residency']))
+                exporter.publish(snapshot, collector_stats)
+
     except KeyboardInterrupt:
         print("\n\nMonitoring stopped by user.")
     except Exception as e:
         print(f"\n\nUnexpected error: {e}")
     finally:
         comm.disconnect()
+        if exporter:
+            exporter.close()
+        if ingest:
+            ingest.close()
+        if timer:
+            timer.close()
     
     return 0
 
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+CPU idle-state residency for the PC Hardware Monitor collector
+Each core exposes cumulative residency in microseconds per idle state under
+/sys/devices/system/cpu/cpuN/cpuidle/stateK/time. The files of the first
+cores are opened once and re-read with pread(); beyond MAX_READERS open
+descriptors the rest are opened and closed around each read, so a many-core
+host does not run the process out of descriptors. Reading every core each
+cycle costs one read per state per core, so on many-core machines only a
+rotating subset is read:
+cores are visited round-robin until the per-cycle CPU budget is used up and
+the next cycle continues with the next core. Each core's residency is taken
+over its own interval since it was last read; the aggregate is the mean of
+the latest per-core residencies, so every core weighs the same whether it was
+read this cycle or a few cycles ago.
+"""
+
+import glob
+import os
+import time
+from typing import Dict, List, Optional
+
+from pc_monitor_lowimpact import ProcReader
+
+DEFAULT_BUDGET_MS = 1.0     # CPU time per cycle for reading residency counters
+MAX_STATES = 9              # Idle states sent (must match UI_CSTATE_SLOTS - 1 in ui_hardware_monitor.h)
+MAX_READERS = 64            # Descriptors kept open across cycles
+
+
+class _Core:
+    __slots__ = ('readers', 'keep', 'times', 'stamp', 'residency')
+
+    def __init__(self, readers: List[ProcReader], keep: bool):
+        self.readers = readers
+        self.keep = keep            # Descriptors stay open between reads
+        self.times: Optional[List[int]] = None
+        self.stamp = 0.0
+        self.residency: Optional[List[float]] = None   # Fraction of the last interval per state
+
+
+class CpuIdleMonitor:
+    """Idle-state residency aggregated across cores, read from a rotating subset within a CPU budget"""
+
+    def __init__(self, cpu_root: str, budget_ms: float = DEFAULT_BUDGET_MS):
+        self.budget_s = budget_ms / 1000.0
+        self.names: List[str] = []
+        self.cores: List[_Core] = []
+        self.next_core = 0
+        self.cores_read = 0         # Cores read in the last cycle
+        self.available = True
+
+        kept = 0
+        cpu_dirs = glob.glob(os.path.join(cpu_root, 'cpu[0-9]*'))
+        for cpu_dir in sorted(cpu_dirs, key=lambda d: int(os.path.basename(d)[3:])):
+            state_dirs = glob.glob(os.path.join(cpu_dir, 'cpuidle', 'state[0-9]*'))
+            state_dirs.sort(key=lambda d: int(os.path.basename(d)[5:]))
+            state_dirs = state_dirs[:MAX_STATES]
+            if not state_dirs:
+                continue
+            if not self.names:
+                for state_dir in state_dirs:
+                    try:
+                        with open(os.path.join(state_dir, 'name'), 'r') as f:
+                            self.names.append(f.read().strip())
+                    except OSError:
+                        self.names.append(os.path.basename(state_dir))
+            keep = kept + len(state_dirs) <= MAX_READERS
+            if keep:
+                kept += len(state_dirs)
+            self.cores.append(_Core([ProcReader(os.path.join(d, 'time'), size=32) for d in state_dirs], keep))
+
+        if not self.cores:
+            self.available = False
+            return
+        print(f"CPU idle states: {' '.join(self.names)} on {len(self.cores)} cores")
+        # Take every core's counters once so the first rotation already yields residencies
+        try:
+            now = time.monotonic()
+            for core in self.cores:
+                self._read_core(core, now)
+        except (OSError, ValueError) as e:
+            print(f"Warning: CPU idle statistics unavailable: {e}")
+            self.available = False
+            self.close()
+
+    def _read_core(self, core: _Core, now: float):
+        try:
+            times = [int(reader.read()) for reader in core.readers]
+        finally:
+            if not core.keep:
+                for reader in core.readers:
+                    reader.close()
+        if core.times is not None and now > core.stamp:
+            elapsed_us = (now - core.stamp) * 1e6
+            core.residency = [min(max(t - p, 0) / elapsed_us, 1.0) for t, p in zip(times, core.times)]
+        core.times = times
+        core.stamp = now
+
+    def sample(self) -> Dict:
+        """Returns state names and residency percentages: [active] + one per state, across all cores"""
+        if not self.available:
+            return {}
+        start = time.perf_counter()
+        deadline = start + self.budget_s
+        count = len(self.cores)
+        read = 0
+        try:
+            # At least one core per cycle, even when a single core costs more than the budget
+            while read < count and (read == 0 or time.perf_counter() < deadline):
+                core = self.cores[self.next_core]
+                self._read_core(core, time.monotonic())
+                self.next_core = (self.next_core + 1) % count
+                read += 1
+        except (OSError, ValueError) as e:
+            print(f"Warning: CPU idle statistics unavailable: {e}")
+            self.available = False
+            self.close()
+            return {}
+        self.cores_read = read
+
+        ready = [core.residency for core in self.cores if core.residency is not None]
+        if not ready:
+            return {}
+        states = [100.0 * sum(r[i] for r in ready if i < len(r)) / len(ready) for i in range(len(self.names))]
+        return {
+            'names': self.names,
+            'residency': [max(100.0 - sum(states), 0.0)] + states,
+        }
+
+    def close(self):
+        for core in self.cores:
+            for reader in core.readers:
+                reader.close()
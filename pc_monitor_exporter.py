@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""
+OpenMetrics exporter for the PC Hardware Monitor collector
+Serves the latest snapshot on a localhost HTTP endpoint. The response body is
+serialized once per sampling cycle, so a scrape only copies a buffer.
+"""
+
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from typing import Dict, List, Optional, Tuple
+
+CONTENT_TYPE = "application/openmetrics-text; version=1.0.0; charset=utf-8"
+PREFIX = "pc_monitor_"
+
+# snapshot key: (metric name, help text)
+GAUGES: List[Tuple[str, str, str]] = [
+    ('cpu',          'cpu_usage_percent',      'CPU utilisation'),
+    ('cpu_freq',     'cpu_frequency_ghz',      'Mean CPU frequency across cores'),
+    ('cpu_freq_pct', 'cpu_frequency_percent',  'Current CPU frequency as percent of hardware maximum'),
+    ('throttle_flags', 'cpu_throttle_flags',   'CPU throttling: 1 frequency capped, 2 thermal events'),
+    ('throttle_limit', 'cpu_frequency_cap_percent', 'Percent of maximum CPU frequency removed by the policy cap'),
+    ('throttle_events', 'cpu_thermal_throttle_events', 'Thermal throttle events in the last interval'),
+    ('cpu_user',     'cpu_user_percent',       'CPU time in user mode (including guest)'),
+    ('cpu_nice',     'cpu_nice_percent',       'CPU time in niced user mode'),
+    ('cpu_system',   'cpu_system_percent',     'CPU time in kernel mode'),
+    ('cpu_irq',      'cpu_irq_percent',        'CPU time in hard and soft interrupts'),
+    ('cpu_iowait',   'cpu_iowait_percent',     'CPU idle time with I/O outstanding'),
+    ('cpu_steal',    'cpu_steal_percent',      'CPU time stolen by the hypervisor'),
+    ('gpu',          'gpu_usage_percent',      'GPU utilisation'),
+    ('ram',          'ram_usage_percent',      'RAM utilisation'),
+    ('ram_used_gb',  'ram_used_gb',            'RAM in use'),
+    ('ram_total_gb', 'ram_total_gb',           'Total RAM'),
+    ('irq_rate',     'interrupts_per_second',  'Hardware interrupts per second, all CPUs'),
+    ('softirq_rate', 'softirqs_per_second',    'Softirqs per second, all CPUs'),
+    ('irq_storm',    'irq_storm',              'Interrupt storm: 1 hardware IRQ, 2 softirq'),
+    ('tcp_retrans_pct', 'tcp_retransmit_percent', 'TCP segments retransmitted, percent of all segments sent'),
+    ('tcp_retrans_per_s', 'tcp_retransmits_per_second', 'TCP segments retransmitted per second'),
+    ('tcp_active_opens', 'tcp_active_opens_per_second', 'Outgoing TCP connections opened per second'),
+    ('tcp_passive_opens', 'tcp_passive_opens_per_second', 'Incoming TCP connections accepted per second'),
+    ('tcp_listen_drops', 'tcp_listen_drops_per_second', 'Connection requests dropped by full listen queues per second'),
+    ('swap_used_mb', 'swap_used_mb',           'Swap in use'),
+    ('swap_total_mb', 'swap_total_mb',         'Total swap'),
+    ('cache_mb',     'page_cache_mb',          'Page cache and buffers'),
+    ('dirty_mb',     'dirty_mb',               'Dirty pages waiting for writeback'),
+    ('writeback_mb', 'writeback_mb',           'Pages under writeback'),
+    ('swap_in_kbs',  'swap_in_kb_per_second',  'Swap-in rate in KB/s'),
+    ('swap_out_kbs', 'swap_out_kb_per_second', 'Swap-out rate in KB/s'),
+    ('major_faults', 'major_faults_per_second', 'Major page faults per second'),
+    ('temp',         'temperature_celsius',    'CPU temperature'),
+    ('fan',          'fan_rpm',                'Fan speed'),
+    ('net_down',     'network_receive_mb_per_second', 'Network receive rate in MB/s'),
+    ('net_up',       'network_transmit_mb_per_second', 'Network transmit rate in MB/s'),
+    ('net_util',     'network_utilization_percent', 'Busier direction as a percentage of link speed (-1 unknown)'),
+    ('battery',      'battery_percent',        'Battery charge (-1 without battery)'),
+    ('power',        'power_watts',            'Battery power draw'),
+]
+
+# snapshot key: (metric name, label name, help text); the snapshot value maps label values to samples
+LABELED_GAUGES: List[Tuple[str, str, str, str]] = [
+    ('numa_cpu',     'numa_cpu_usage_percent', 'node', 'CPU utilisation per NUMA node'),
+    ('numa_mem',     'numa_memory_used_percent', 'node', 'Memory used per NUMA node, page cache excluded'),
+    ('cpuidle',      'cpu_idle_state_residency_percent', 'state', 'Share of CPU time per idle state, mean across cores'),
+    ('fs_used_pct',  'filesystem_used_percent', 'mount', 'Space used per tracked filesystem, reserved blocks excluded'),
+    ('irq_top',      'irq_top_source_rate_per_second', 'source', 'Interrupts per second of the busiest IRQ lines'),
+]
+
+
+def _label(value) -> str:
+    """Escape a label value as OpenMetrics requires (mount points and device names can hold any of these)"""
+    return str(value).replace('\\', '\\\\').replace('"', '\\"').replace('\n', '\\n')
+
+
+class CollectorStats:
+    """Collector self-metrics: per-source sample latency, frames sent, link errors, own footprint"""
+
+    def __init__(self):
+        self.source_latency: Dict[str, float] = {}
+        self.frames_sent = 0
+        self.link_errors = 0
+        self.cycles = 0
+        self.footprint: Dict[str, float] = {}
+
+    def timed(self, source: str, getter, *args):
+        """Call a getter and record its latency under `source`"""
+        start = time.perf_counter()
+        result = getter(*args)
+        self.source_latency[source] = time.perf_counter() - start
+        return result
+
+
+class MetricsExporter:
+    """Localhost OpenMetrics endpoint backed by a pre-serialized payload"""
+
+    def __init__(self, port: int, bind: str = "127.0.0.1"):
+        self.payload = b"# EOF\n"
+        self.server = ThreadingHTTPServer((bind, port), _MetricsHandler)
+        self.server.daemon_threads = True
+        self.server.exporter = self
+        self.thread = threading.Thread(target=self.server.serve_forever,
+                                       name="metrics-exporter", daemon=True)
+        self.thread.start()
+        print(f"OpenMetrics exporter listening on http://{bind}:{port}/metrics")
+
+    def publish(self, snapshot: Dict[str, float], stats: CollectorStats):
+        """Serialize the latest snapshot; called once per sampling cycle"""
+        lines: List[str] = []
+        for key, name, help_text in GAUGES:
+            if key not in snapshot:
+                continue
+            lines.append(f"# TYPE {PREFIX}{name} gauge")
+            lines.append(f"# HELP {PREFIX}{name} {help_text}")
+            lines.append(f"{PREFIX}{name} {snapshot[key]}")
+        for key, name, label, help_text in LABELED_GAUGES:
+            if not snapshot.get(key):
+                continue
+            lines.append(f"# TYPE {PREFIX}{name} gauge")
+            lines.append(f"# HELP {PREFIX}{name} {help_text}")
+            for label_value, value in snapshot[key].items():
+                lines.append(f'{PREFIX}{name}{{{label}="{_label(label_value)}"}} {value}')
+
+        lines.append(f"# TYPE {PREFIX}source_sample_latency_seconds gauge")
+        lines.append(f"# HELP {PREFIX}source_sample_latency_seconds Time spent reading each source in the last cycle")
+        for source, seconds in stats.source_latency.items():
+            lines.append(f'{PREFIX}source_sample_latency_seconds{{source="{_label(source)}"}} {seconds:.9f}')
+
+        for key, help_text in (
+                ('wakeups_per_sec', 'Collector wakeups per second'),
+                ('cpu_ms_per_sec', 'Collector CPU milliseconds per second'),
+                ('rss_mb', 'Collector resident set size in MB')):
+            if key in stats.footprint:
+                lines.append(f"# TYPE {PREFIX}self_{key} gauge")
+                lines.append(f"# HELP {PREFIX}self_{key} {help_text}")
+                lines.append(f"{PREFIX}self_{key} {stats.footprint[key]}")
+
+        for name, help_text, value in (
+                ('frames_sent', 'Frames written to the device', stats.frames_sent),
+                ('link_errors', 'Failed writes to the device', stats.link_errors),
+                ('sample_cycles', 'Sampling cycles run', stats.cycles)):
+            lines.append(f"# TYPE {PREFIX}{name} counter")
+            lines.append(f"# HELP {PREFIX}{name} {help_text}")
+            lines.append(f"{PREFIX}{name}_total {value}")
+
+        lines.append("# EOF")
+        self.payload = ("\n".join(lines) + "\n").encode()
+
+    def close(self):
+        self.server.shutdown()
+        self.server.server_close()
+
+
+class _MetricsHandler(BaseHTTPRequestHandler):
+    def do_GET(self):
+        if self.path.split('?', 1)[0] != '/metrics':
+            self.send_error(404)
+            return
+        body = self.server.exporter.payload
+        self.send_response(200)
+        self.send_header("Content-Type", CONTENT_TYPE)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def log_message(self, format, *args):
+        pass  # Keep scrapes off the console status line
+
+
+def start_exporter(port: Optional[int], bind: str = "127.0.0.1") -> Optional[MetricsExporter]:
+    """Start the exporter if a port was given; returns None when disabled or on bind failure"""
+    if not port:
+        return None
+    try:
+        return MetricsExporter(port, bind)
+    except OSError as e:
+        print(f"Warning: Could not start OpenMetrics exporter on {bind}:{port}: {e}")
+        return None
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+Filesystem capacity for the PC Hardware Monitor collector
+The mount table is parsed once at start and again only when the kernel
+reports a change: /proc/self/mountinfo raises POLLPRI | POLLERR on its open
+descriptor after any mount or unmount, so a zero-timeout poll() per cycle
+replaces rescanning. Tracked filesystems are checked with statvfs() at a slow
+cadence (capacity moves slowly) and right after a mount change.
+
+Without configured mount points, every writable local filesystem is tracked
+once per device. Pseudo filesystems, read-only images and network
+filesystems (whose statvfs can hang on a dead server) are skipped unless
+named explicitly.
+"""
+
+import os
+import re
+import select
+import time
+from typing import Callable, Dict, List, Optional
+
+from pc_monitor_lowimpact import ProcReader, split_lines
+
+DEFAULT_INTERVAL_S = 30.0
+DEFAULT_ALERT_PCT = 90.0
+
+SKIP_FSTYPES = {
+    b'proc', b'sysfs', b'devtmpfs', b'devpts', b'tmpfs', b'ramfs', b'cgroup', b'cgroup2', b'securityfs',
+    b'pstore', b'bpf', b'tracefs', b'debugfs', b'configfs', b'fusectl', b'mqueue', b'hugetlbfs', b'autofs',
+    b'binfmt_misc', b'efivarfs', b'nsfs', b'rpc_pipefs', b'selinuxfs', b'squashfs', b'iso9660', b'erofs',
+    b'nfs', b'nfs4', b'cifs', b'smb3', b'9p', b'fuse.sshfs', b'fuse.gvfsd-fuse', b'fuse.portal',
+}
+
+_ESCAPE = re.compile(rb'\\([0-7]{3})')
+
+
+def _unescape(field: bytes) -> str:
+    """mountinfo escapes space, tab, newline and backslash as \\ooo"""
+    return _ESCAPE.sub(lambda match: bytes([int(match.group(1), 8)]), field).decode(errors='replace')
+
+
+class FsMonitor:
+    """Used percentage of the fullest tracked filesystem, with mount changes taken from poll()"""
+
+    def __init__(self, mountinfo_path: str, resolve: Callable[[str], str],
+                 mounts: Optional[List[str]] = None, interval_s: float = DEFAULT_INTERVAL_S,
+                 alert_pct: float = DEFAULT_ALERT_PCT):
+        self.mountinfo = ProcReader(mountinfo_path, size=16384)
+        self.resolve = resolve          # Mount point -> path to statvfs (fixture roots)
+        self.mounts = mounts or []      # Configured mount points; empty = auto-detect
+        self.interval_s = interval_s
+        self.alert_pct = alert_pct
+        self.poller = None
+        self.filesystems: List[str] = []
+        self.usage: Dict[str, float] = {}   # Mount point -> used %, as df computes it
+        self.next_check = 0.0
+        self.scans = 0
+        self.available = True
+
+    def _scan(self):
+        """Rebuild the tracked mount list from mountinfo"""
+        data = self.mountinfo.read()
+        if self.poller is None:
+            self.poller = select.poll()
+            self.poller.register(self.mountinfo.fd, select.POLLPRI | select.POLLERR)
+
+        devices = set()
+        filesystems = []
+        for line in split_lines(data):
+            # id parent major:minor root mount-point options [optional...] - fstype source super-options
+            fields = line.split()
+            try:
+                sep = fields.index(b'-', 6)
+                fstype = fields[sep + 1]
+            except (ValueError, IndexError):
+                continue
+            mount_point = _unescape(fields[4])
+            if self.mounts:
+                if mount_point not in self.mounts:
+                    continue
+            elif fstype in SKIP_FSTYPES or b'ro' in fields[5].split(b',') or fields[2] in devices:
+                continue
+            devices.add(fields[2])
+            filesystems.append(mount_point)
+
+        self.filesystems = filesystems
+        self.usage = {mount: pct for mount, pct in self.usage.items() if mount in filesystems}
+        self.next_check = 0.0
+        self.scans += 1
+
+    def _changed(self) -> bool:
+        return self.poller is None or bool(self.poller.poll(0))
+
+    def _check(self):
+        for mount in self.filesystems:
+            try:
+                st = os.statvfs(self.resolve(mount))
+            except OSError:
+                self.usage.pop(mount, None)
+                continue
+            # Reserved blocks count as neither used nor available, as in df
+            used = st.f_blocks - st.f_bfree
+            total = used + st.f_bavail
+            if total > 0:
+                self.usage[mount] = 100.0 * used / total
+
+    def sample(self) -> Dict:
+        """Returns used_pct and mount of the fullest filesystem, alert, and used % per mount"""
+        if not self.available:
+            return {}
+        now = time.monotonic()
+        try:
+            if self._changed():
+                self._scan()
+        except OSError as e:
+            print(f"Warning: Mount table unavailable: {e}")
+            self.available = False
+            return {}
+
+        if now >= self.next_check:
+            self._check()
+            self.next_check = now + self.interval_s
+        if not self.usage:
+            return {}
+
+        mount, used_pct = max(self.usage.items(), key=lambda item: item[1])
+        return {
+            'used_pct': used_pct,
+            'mount': mount,
+            'alert': used_pct >= self.alert_pct,
+            'filesystems': dict(self.usage),
+        }
+
+    def close(self):
+        self.mountinfo.close()
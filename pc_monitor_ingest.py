@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+Custom metric ingestion for the PC Hardware Monitor collector
+Local programs push key/value metrics with a TTL to a Unix datagram socket.
+The collector drains the socket once per sampling cycle, so pushes never
+wake it, and forwards up to MAX_METRICS live values to the device's custom
+metrics page.
+
+Datagram formats (several text pushes may share one datagram, one per line):
+  text:    name=value[,ttl_seconds]          e.g. b"queue_depth=42,30"
+  binary:  0x00, <float32 value>, <uint16 ttl_seconds>, name   (little endian)
+A push without a value, or with TTL 0, removes the metric; NaN and infinite
+values or TTLs are ignored.
+The kernel queues at most net.unix.max_dgram_qlen (default 10) datagrams
+between drains; further sends fail instead of blocking, so a client pushing
+many metrics at once should batch them into one text datagram.
+"""
+
+import errno
+import math
+import os
+import socket
+import stat
+import struct
+import time
+from typing import Dict, List, Optional, Tuple
+
+MAX_METRICS = 6          # Rows on the device page (UI_CUSTOM_ROWS)
+MAX_NAME_LEN = 23        # String dictionary limit on the device
+DEFAULT_TTL = 30.0
+MAX_DATAGRAM = 512
+MAX_PER_CYCLE = 1024     # Bound the work done in one drain
+_BINARY = struct.Struct('<BfH')
+
+
+def default_socket_path() -> str:
+    runtime_dir = os.environ.get('XDG_RUNTIME_DIR')
+    if runtime_dir:
+        return os.path.join(runtime_dir, 'pc-monitor.sock')
+    return f'/tmp/pc-monitor-{os.getuid()}.sock'
+
+
+def _remove_stale(path: str):
+    """Unlink a socket left by a previous run; raises if another collector still listens on it"""
+    if not stat.S_ISSOCK(os.lstat(path).st_mode):
+        raise OSError(errno.EEXIST, "Path exists and is not a socket", path)
+    probe = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+    try:
+        probe.connect(path)
+    except ConnectionRefusedError:
+        os.unlink(path)
+        return
+    finally:
+        probe.close()
+    raise OSError(errno.EADDRINUSE, "Another collector is listening", path)
+
+
+class IngestSocket:
+    """Non-blocking Unix datagram socket plus the table of live custom metrics"""
+
+    def __init__(self, path: str):
+        self.path = path
+        self.metrics: Dict[str, Tuple[float, float]] = {}   # name -> (value, expiry), in arrival order
+        self.dirty = False      # Table changed since the last frame was sent
+        self.pushes = 0
+        self.buffer = bytearray(MAX_DATAGRAM)
+
+        if os.path.exists(path):
+            _remove_stale(path)
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+        self.sock.bind(path)
+        self.sock.setblocking(False)
+        print(f"Custom metric socket: {path}")
+
+    def drain(self, now: float):
+        """Apply every pending push and expire old metrics; called once per sampling cycle"""
+        view = memoryview(self.buffer)
+        for _ in range(MAX_PER_CYCLE):
+            try:
+                length = self.sock.recv_into(self.buffer)
+            except (BlockingIOError, InterruptedError):
+                break
+            except OSError:
+                break
+            if length:
+                self._apply(view[:length], now)
+
+        for name in [n for n, (_, expiry) in self.metrics.items() if expiry <= now]:
+            del self.metrics[name]
+            self.dirty = True
+
+    def _apply(self, datagram: memoryview, now: float):
+        if datagram[0] == 0 and len(datagram) > _BINARY.size:
+            _, value, ttl = _BINARY.unpack_from(datagram)
+            self._set(bytes(datagram[_BINARY.size:]).decode(errors='replace'), value, float(ttl), now)
+            return
+
+        for line in bytes(datagram).decode(errors='replace').splitlines():
+            name, _, rest = line.partition('=')
+            value_text, _, ttl_text = rest.partition(',')
+            try:
+                value = float(value_text) if value_text.strip() else None
+                ttl = float(ttl_text) if ttl_text.strip() else DEFAULT_TTL
+            except ValueError:
+                continue
+            self._set(name, value, ttl, now)
+
+    def _set(self, name: str, value: Optional[float], ttl: float, now: float):
+        name = name.strip()[:MAX_NAME_LEN]
+        if not name or not math.isfinite(ttl) or (value is not None and not math.isfinite(value)):
+            return
+        self.pushes += 1
+        if value is None or ttl <= 0:
+            if self.metrics.pop(name, None) is not None:
+                self.dirty = True
+            return
+        previous = self.metrics.get(name)
+        if previous is None or previous[0] != value:
+            self.dirty = True
+        self.metrics[name] = (value, now + ttl)
+
+    def active(self) -> List[Tuple[str, float]]:
+        """Live metrics in arrival order, at most MAX_METRICS"""
+        return [(name, value) for name, (value, _) in list(self.metrics.items())[:MAX_METRICS]]
+
+    def close(self):
+        self.sock.close()
+        try:
+            os.unlink(self.path)
+        except OSError:
+            pass
+
+
+def start_ingest(path: Optional[str]) -> Optional[IngestSocket]:
+    """Open the ingestion socket if a path was given; returns None when disabled or on failure"""
+    if not path:
+        return None
+    try:
+        return IngestSocket(path)
+    except OSError as e:
+        print(f"Warning: Could not open custom metric socket {path}: {e}")
+        return None
+
+
+_client: Optional[socket.socket] = None
+
+
+def push(name: str, value: Optional[float], ttl: float = DEFAULT_TTL, path: Optional[str] = None) -> bool:
+    """Client helper: push one metric (value None removes it); never blocks"""
+    global _client
+    if _client is None:
+        _client = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+        _client.setblocking(False)
+    payload = f"{name}={'' if value is None else value},{ttl:g}".encode()
+    try:
+        _client.sendto(payload, path or default_socket_path())
+        return True
+    except OSError:
+        return False
+
+
+if __name__ == "__main__":
+    # Usage: python3 pc_monitor_ingest.py NAME VALUE [TTL]   (pushes to the default socket)
+    import sys
+    if len(sys.argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+    start = time.perf_counter()
+    ok = push(sys.argv[1], float(sys.argv[2]), float(sys.argv[3]) if len(sys.argv) > 3 else DEFAULT_TTL)
+    print(f"{'Pushed' if ok else 'Failed to push'} in {(time.perf_counter() - start) * 1e6:.0f} us")
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""
+Interrupt and softirq activity for the PC Hardware Monitor collector
+/proc/interrupts grows with CPUs x vectors and reaches hundreds of KB on
+many-core servers. Each table is read into a reusable buffer and its layout
+(where each row's run of per-CPU cells starts and ends) is cached until the header or file
+length changes. The kernel prints every counter in a fixed-width cell, so
+the layout stays valid while the set of rows and CPUs is unchanged. Rows whose
+bytes did not change since the last pass are skipped without parsing.
+Parsing stops when the per-cycle CPU budget is used up and the next pass
+continues where it stopped; each row's rate uses its own timestamps. When
+reading the table alone costs more than the budget, passes are spaced out
+over several cycles so the average cost stays within it.
+
+A storm is a row whose busiest CPU exceeds both an absolute rate and a
+multiple of that row's slowly adapting baseline.
+"""
+
+import re
+import time
+from typing import Dict, List, Optional
+
+from pc_monitor_lowimpact import ProcReader
+
+DEFAULT_BUDGET_MS = 2.0     # CPU time per cycle for both tables
+STORM_IRQ_RATE = 20000      # Per CPU per second
+STORM_SOFTIRQ_RATE = 100000
+STORM_FACTOR = 10.0         # Times the row's baseline
+BASELINE_ALPHA = 0.02       # EWMA weight of a new sample in the baseline
+TOP_SOURCES = 3
+
+IRQ_STORM = 1               # IRQ: flag bits (must match IRQ_STORM_* in main.cpp)
+SOFTIRQ_STORM = 2
+
+_CELL = re.compile(rb' *\d+')
+_DIGITS = b'0123456789'
+
+
+class _Row:
+    __slots__ = ('label', 'name', 'start', 'end', 'cells', 'raw', 'counts', 'stamp',
+                 'rate', 'cpu_peak', 'baseline')
+
+    def __init__(self, label: str, name: str):
+        self.label = label
+        self.name = name            # Device or softirq name shown on the display
+        self.start = self.end = 0   # Absolute offsets of the run of counter cells in the file
+        self.cells = 0
+        self.raw = b''
+        self.counts: List[int] = []
+        self.stamp = 0.0
+        self.rate = 0.0             # Events per second, all CPUs
+        self.cpu_peak = 0.0         # Events per second on the busiest CPU
+        self.baseline: Optional[float] = None
+
+
+class CounterTable:
+    """One per-CPU counter table (/proc/interrupts or /proc/softirqs) with a cached layout"""
+
+    def __init__(self, path: str, storm_rate: float):
+        self.reader = ProcReader(path, size=65536)
+        self.storm_rate = storm_rate
+        self.header = b''
+        self.length = -1
+        self.rows: List[_Row] = []
+        self.next_row = 0           # Round-robin position when the budget ran out
+        self.skip = 0               # Cycles to wait before the next pass
+        self.layouts = 0            # Layout parses since start
+
+    def _layout(self, data: bytes, now: float):
+        header_end = data.find(b'\n')
+        cpus = data.count(b'CPU', 0, header_end)
+        previous = {row.label: row for row in self.rows}
+        rows = []
+        pos = header_end + 1
+        while pos < len(data):
+            end = data.find(b'\n', pos)
+            if end < 0:
+                end = len(data)
+            colon = data.find(b':', pos, end)
+            if colon > 0:
+                # Cells are fixed width ("%10u"), so the first one gives every offset
+                cells = 0
+                for token in data[colon + 1:end].split(None, cpus)[:cpus]:
+                    if not token.isdigit():
+                        break
+                    cells += 1
+                first = _CELL.match(data, colon + 1, end)
+                width = first.end() - first.start() if first else 0
+                cell_end = colon + 1 + cells * width
+                if cells and (data[cell_end - 1] not in _DIGITS or data[cell_end:cell_end + 1].isdigit()):
+                    # Not fixed width after all: walk the cells
+                    cells = 0
+                    cell_end = colon + 1
+                    for match in _CELL.finditer(data, cell_end, end):
+                        if match.start() != cell_end or cells == cpus:
+                            break
+                        cell_end = match.end()
+                        cells += 1
+                label = data[pos:colon].strip().decode(errors='replace')
+                description = data[cell_end:end].split()
+                name = description[-1].decode(errors='replace') if label.isdigit() and description else label
+                row = previous.get(label)
+                if row is None or row.cells != cells:
+                    row = _Row(label, name)
+                    row.cells = cells
+                row.name = name
+                row.start, row.end = colon + 1, cell_end
+                if not row.counts:
+                    # First sight of this row: take its counters now so rates start next pass
+                    row.raw = data[row.start:row.end]
+                    row.counts = [int(value) for value in row.raw.split()]
+                    row.stamp = now
+                rows.append(row)
+            pos = end + 1
+
+        self.header = data[:header_end]
+        self.length = len(data)
+        self.rows = rows
+        self.next_row = 0
+        self.layouts += 1
+
+    def sample(self, now: float, budget_s: float):
+        """Update row rates within budget_s of CPU time; unprocessed rows wait for the next pass"""
+        if self.skip:
+            self.skip -= 1
+            return
+        start = time.perf_counter()
+        data = self.reader.read()
+        buf = data.obj      # The reader's buffer: bounded bytearray methods compare rows without copies
+        if len(data) != self.length or not buf.startswith(self.header, 0, len(data)):
+            self._layout(bytes(data), now)
+            start = time.perf_counter()     # Layout changes are rare; they do not count against pacing
+        # Parse at least a few rows even when the read alone used up the budget
+        deadline = max(start + budget_s, time.perf_counter() + budget_s / 4)
+
+        rows = self.rows
+        count = len(rows)
+        for i in range(count):
+            index = (self.next_row + i) % count
+            if time.perf_counter() > deadline:
+                self.next_row = index
+                break
+            row = rows[index]
+            if buf.startswith(row.raw, row.start, row.end):
+                row.rate = row.cpu_peak = 0.0
+                row.stamp = now
+                continue
+
+            row.raw = bytes(data[row.start:row.end])
+            counts = [int(value) for value in row.raw.split()]
+            elapsed = now - row.stamp
+            if row.counts and elapsed > 0:
+                deltas = [c - p for c, p in zip(counts, row.counts)]
+                row.rate = max(sum(deltas), 0) / elapsed
+                row.cpu_peak = max(max(deltas), 0) / elapsed
+                if row.baseline is None:
+                    row.baseline = row.cpu_peak
+                elif not self.storming(row):
+                    row.baseline += BASELINE_ALPHA * (row.cpu_peak - row.baseline)
+            row.counts = counts
+            row.stamp = now
+        else:
+            self.next_row = 0
+        self.skip = int((time.perf_counter() - start) / budget_s)
+
+    def storming(self, row: _Row) -> bool:
+        baseline = row.baseline if row.baseline is not None else 0.0
+        return row.cpu_peak > self.storm_rate and row.cpu_peak > STORM_FACTOR * baseline
+
+    def total_rate(self) -> float:
+        return sum(row.rate for row in self.rows)
+
+    def storm_row(self) -> Optional[_Row]:
+        """Busiest row currently in a storm, if any"""
+        storms = [row for row in self.rows if self.storming(row)]
+        return max(storms, key=lambda row: row.cpu_peak) if storms else None
+
+    def close(self):
+        self.reader.close()
+
+
+class IrqMonitor:
+    """Per-cycle interrupt and softirq rates, top sources and storm flags within a CPU budget"""
+
+    def __init__(self, interrupts_path: str, softirqs_path: str, budget_ms: float = DEFAULT_BUDGET_MS):
+        self.interrupts = CounterTable(interrupts_path, STORM_IRQ_RATE)
+        self.softirqs = CounterTable(softirqs_path, STORM_SOFTIRQ_RATE)
+        self.budget_s = budget_ms / 1000.0
+        self.available = True
+
+    def sample(self) -> Dict:
+        """Returns irq_rate, softirq_rate (per second), storm flags, storm_source and top [(source, rate)]"""
+        if not self.available:
+            return {}
+        now = time.monotonic()
+        try:
+            # The softirq table has ten rows and gets a quarter of the budget
+            self.softirqs.sample(now, self.budget_s / 4)
+            self.interrupts.sample(now, self.budget_s * 3 / 4)
+        except OSError as e:
+            print(f"Warning: Interrupt statistics unavailable: {e}")
+            self.available = False
+            return {}
+
+        irq_storm = self.interrupts.storm_row()
+        softirq_storm = self.softirqs.storm_row()
+        top = sorted((row for row in self.interrupts.rows if row.rate > 0), key=lambda row: row.rate,
+                     reverse=True)[:TOP_SOURCES]
+        storm = irq_storm or softirq_storm
+        return {
+            'irq_rate': self.interrupts.total_rate(),
+            'softirq_rate': self.softirqs.total_rate(),
+            'storm': (IRQ_STORM if irq_storm else 0) | (SOFTIRQ_STORM if softirq_storm else 0),
+            'storm_source': storm.name if storm else None,
+            # Numbered lines as "<irq>:<device>", since several lines can share a device name
+            'top': [(row.name if row.name == row.label else f"{row.label}:{row.name}", row.rate) for row in top],
+        }
+
+    def close(self):
+        self.interrupts.close()
+        self.softirqs.close()
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""
+Multiplexed serial link for the PC Hardware Monitor collector
+Host side of include/Serial_Mux.h. Every message travels in its own frame
+on a channel: realtime (metric lines), control (commands and replies), log
+(device text) and bulk (long transfers such as the black-box dump, sent by
+the device in MUX_BULK_CHUNK pieces with FIN on the last one). A frame is
+<channel << 4 | flags> <seq> <payload> <crc16 BE>, COBS-encoded between
+0x00 delimiters, so a damaged frame is dropped and the next delimiter
+resyncs the stream. The per-channel seq exposes dropped frames: receive()
+marks the first frame after a gap with FLAG_GAP, so a bulk transfer can be
+rejected instead of decoded with a hole in it.
+
+negotiate() sends a HELLO control frame; firmware without framing answers
+nothing recognizable and the link stays in legacy newline-terminated lines.
+Queued messages are written realtime first, so a metric line never waits
+behind a command or anything else the host has queued.
+"""
+
+import collections
+import time
+from typing import Deque, Dict, List, Optional, Tuple
+
+MUX_VERSION = 1             # Must match MUX_VERSION in include/Serial_Mux.h
+MAX_PAYLOAD = 127
+FLAG_FIN = 0x01
+FLAG_ERROR = 0x02           # With FIN: the device dropped bytes of the transfer
+FLAG_GAP = 0x10             # Set by receive(), never sent: frames were lost before this one
+
+REALTIME, CONTROL, LOG, BULK = range(4)
+CHANNELS = 4
+
+
+def crc16(data: bytes) -> int:
+    """CRC-16/CCITT-FALSE"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_encode(data: bytes) -> bytes:
+    out = bytearray()
+    for block in data.split(b'\x00'):
+        # Blocks longer than 254 bytes continue behind a 0xFF code without an implied zero
+        while len(block) >= 0xFE:
+            out += b'\xff' + block[:0xFE]
+            block = block[0xFE:]
+        out += bytes([len(block) + 1]) + block
+    return bytes(out)
+
+
+def cobs_decode(data: bytes) -> Optional[bytes]:
+    """Decoded bytes, or None for a malformed block"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+class SerialMux:
+    """Prioritized channels over one pyserial port, with a legacy line-mode fallback"""
+
+    def __init__(self, port):
+        self.port = port
+        self.framed = False
+        self.queues: Dict[int, Deque[bytes]] = {channel: collections.deque() for channel in (REALTIME, CONTROL)}
+        self.seq = [0] * CHANNELS
+        self.rx_seq: List[Optional[int]] = [None] * CHANNELS    # Next expected seq per channel
+        self.rx = bytearray()
+        self.in_frame = False
+        self.bad_frames = 0
+
+    def encode(self, channel: int, payload: bytes, flags: int = 0) -> bytes:
+        raw = bytes([channel << 4 | flags, self.seq[channel]]) + payload
+        self.seq[channel] = (self.seq[channel] + 1) & 0xFF
+        raw += crc16(raw).to_bytes(2, 'big')
+        return b'\x00' + cobs_encode(raw) + b'\x00'
+
+    def send(self, channel: int, payload: bytes):
+        """Queue one message (no newline, at most MAX_PAYLOAD bytes); written by the next pump()"""
+        self.queues[channel].append(payload)
+
+    def pump(self):
+        """Write every queued message, realtime first, in one write"""
+        out = bytearray()
+        for channel in (REALTIME, CONTROL):
+            queue = self.queues[channel]
+            while queue:
+                payload = queue.popleft()
+                out += self.encode(channel, payload) if self.framed else payload + b'\n'
+        if out:
+            self.port.write(out)
+            self.port.flush()
+
+    def receive(self) -> List[Tuple[int, bytes, int]]:
+        """(channel, payload, flags) for every complete message waiting; never blocks
+
+        Lines outside frames (legacy firmware, or text before the device saw a
+        frame) are returned on the control channel.
+        """
+        waiting = self.port.in_waiting
+        if not waiting:
+            return []
+        messages = []
+        for byte in self.port.read(waiting):
+            if byte == 0:
+                if self.in_frame and self.rx:
+                    self.in_frame = False
+                    message = self._decode(bytes(self.rx))
+                    if message:
+                        messages.append(message)
+                else:
+                    self.in_frame = True
+                self.rx.clear()
+            elif self.in_frame:
+                self.rx.append(byte)
+                if len(self.rx) > MAX_PAYLOAD + 8:
+                    self.bad_frames += 1
+                    self.in_frame = False
+                    self.rx.clear()
+            elif byte in b'\r\n':
+                if self.rx:
+                    messages.append((CONTROL, bytes(self.rx), 0))
+                    self.rx.clear()
+            elif len(self.rx) < 256:    # Bound an unterminated line
+                self.rx.append(byte)
+        return messages
+
+    def _decode(self, encoded: bytes) -> Optional[Tuple[int, bytes, int]]:
+        raw = cobs_decode(encoded)
+        if raw is None or len(raw) < 4 or crc16(raw[:-2]) != int.from_bytes(raw[-2:], 'big') \
+                or raw[0] >> 4 >= CHANNELS:
+            self.bad_frames += 1
+            return None
+        channel, flags, seq = raw[0] >> 4, raw[0] & 0x0F, raw[1]
+        expected = self.rx_seq[channel]
+        if expected is not None and seq != expected:
+            flags |= FLAG_GAP
+        self.rx_seq[channel] = (seq + 1) & 0xFF
+        return channel, raw[2:-2], flags
+
+    def negotiate(self, timeout: float = 1.0) -> bool:
+        """Offer framing with HELLO; falls back to legacy lines when the device does not answer framed"""
+        self.framed = False
+        # The newline ends the frame's bytes as a bad line on firmware without framing
+        self.port.write(self.encode(CONTROL, b'HELLO') + b'\n')
+        self.port.flush()
+        deadline = time.monotonic() + timeout
+        while time.monotonic() < deadline:
+            for channel, payload, _ in self.receive():
+                if channel == CONTROL and payload.startswith(b'HELLO:'):
+                    self.framed = True
+                    return True
+            time.sleep(0.01)
+        return False
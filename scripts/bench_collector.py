@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Collector scaling benchmark
+Runs SystemMonitor against synthetic fixture trees (scripts/make_fixture.py)
+and reports per-cycle CPU time and allocations while one dimension grows.
+
+Usage: python3 scripts/bench_collector.py [--cycles N] [--dimension cpus]
+"""
+
+import argparse
+import contextlib
+import io
+import os
+import sys
+import tempfile
+import time
+import tracemalloc
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+from pc_monitor import SystemMonitor  # noqa: E402
+import make_fixture  # noqa: E402
+
+# Small baseline; each dimension is swept up to production scale on its own. Process
+# and disk counts stay at the baseline: no per-cycle path reads /proc/<pid> or
+# /proc/diskstats, and mountinfo is only rescanned when it changes.
+BASE_SCALE = {'cpus': 4, 'pids': 50, 'hwmon': 2, 'disks': 1, 'ifaces': 2}
+SWEEP = {
+    'cpus':   [4, 32, 128, 256],
+    'hwmon':  [2, 8, 16, 32],
+    'ifaces': [2, 10, 50, 100],
+}
+
+
+def sample(monitor: SystemMonitor):
+    """One collector cycle, same getters as the main loop"""
+    monitor.get_cpu_usage()
+    monitor.get_cpu_frequency()
+    monitor.get_cpu_idle_states()
+    monitor.get_gpu_usage()
+    monitor.get_ram_usage()
+    monitor.get_vm_activity()
+    monitor.get_irq_activity()
+    monitor.get_tcp_health()
+    monitor.get_numa_memory()
+    monitor.get_filesystem_usage()
+    monitor.get_temperature()
+    monitor.get_fan_speed()
+    monitor.get_network_speed()
+    monitor.get_battery_info()
+
+
+def bench(scale: dict, cycles: int) -> tuple:
+    """Returns (CPU ms per cycle, bytes allocated per cycle, peak bytes)"""
+    with tempfile.TemporaryDirectory(prefix='pcmon-fixture-') as root:
+        make_fixture.build(root, scale)
+        with contextlib.redirect_stdout(io.StringIO()):
+            monitor = SystemMonitor(net_include=['*'], root=root)
+            sample(monitor)  # prime deltas
+
+        cpu_total = 0.0
+        for tick in range(2, cycles + 2):
+            make_fixture.advance(root, scale, tick)
+            start = time.process_time()
+            sample(monitor)
+            cpu_total += time.process_time() - start
+
+        make_fixture.advance(root, scale, cycles + 2)
+        tracemalloc.start()
+        before, _ = tracemalloc.get_traced_memory()
+        sample(monitor)
+        after, peak = tracemalloc.get_traced_memory()
+        tracemalloc.stop()
+
+    return cpu_total * 1000.0 / cycles, after - before, peak
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Collector scaling benchmark on synthetic fixtures")
+    parser.add_argument('--cycles', type=int, default=50, help="Sampling cycles per data point (default 50)")
+    parser.add_argument('--dimension', choices=sorted(SWEEP), action='append',
+                        help="Only sweep this dimension (repeatable)")
+    args = parser.parse_args()
+
+    print(f"{'dimension':<10} {'count':>6} {'cpu ms/cycle':>13} {'retained B':>11} {'peak B':>10}")
+    for dimension in args.dimension or SWEEP:
+        for count in SWEEP[dimension]:
+            scale = dict(BASE_SCALE, **{dimension: count})
+            cpu_ms, retained, peak = bench(scale, args.cycles)
+            print(f"{dimension:<10} {count:>6} {cpu_ms:>13.3f} {retained:>11} {peak:>10}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,47 @@
+/*
+ * Host benchmark for the boot splash decoder
+ *
+ *   g++ -O2 -Iinclude scripts/bench_splash.cpp src/Splash_Image.c -o bench_splash && ./bench_splash
+ *
+ * Reports flash size against raw RGB565 and the decode cost per frame and
+ * per scanline. The SPI time is the wire time of the decoded frame at the
+ * panel clock for comparison; on the device decoding overlaps nothing, so
+ * decode + SPI is the time from DISPON to a complete splash.
+ */
+#include <chrono>
+#include <stdio.h>
+#include "Splash_Decoder.h"
+#include "Splash_Image.h"
+
+int main() {
+  const int rounds = 2000;
+  SplashDecoder splash;
+  static uint16_t line[1024];
+  uint32_t checksum = 0;
+
+  if (!splash.begin(splash_image, splash_image_len) || splash.width() > 1024) {
+    fprintf(stderr, "splash_image is not a valid splash stream\n");
+    return 1;
+  }
+  const uint32_t pixels = (uint32_t)splash.width() * splash.height();
+
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    splash.begin(splash_image, splash_image_len);
+    for (uint16_t y = 0; y < splash.height(); y++) {
+      if (!splash.next_line(line)) {
+        fprintf(stderr, "decode failed at line %u\n", y);
+        return 1;
+      }
+      checksum += line[y % splash.width()];
+    }
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+
+  printf("Splash %ux%u: %u bytes flash, raw %u bytes (%.1fx)\n", splash.width(), splash.height(),
+         (unsigned)splash_image_len, pixels * 2, pixels * 2.0 / splash_image_len);
+  printf("Decode: %.1f us per frame, %.3f us per line, %.0f Mpixel/s (checksum %08x)\n",
+         us, us / splash.height(), pixels / us, (unsigned)checksum);
+  printf("SPI at 80 MHz: %.1f ms per frame\n", pixels * 16 / 80e6 * 1e3);
+  return 0;
+}
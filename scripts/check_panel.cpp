@@ -0,0 +1,126 @@
+/*
+ * Host check for the compile-time panel driver
+ *
+ *   g++ -std=c++17 -Iinclude scripts/check_panel.cpp -o check_panel && ./check_panel
+ *
+ * Instantiates PanelDriver for every panel config against a bus that records
+ * each command and data burst, then checks the init sequence framing, the
+ * RAM window offsets, the pixel byte order and the frame-rate sequences.
+ * Exits non-zero on the first mismatch.
+ */
+#include <stdio.h>
+#include <vector>
+#include "Panel_Config.h"
+
+struct Burst {
+  bool command;
+  std::vector<uint8_t> bytes;
+};
+
+static std::vector<Burst> bursts;
+static uint32_t delayed_ms;
+
+template <typename Config>
+struct MockBus {
+  static void begin() { bursts.clear(); delayed_ms = 0; }
+  static void reset() {}
+  static void delay_ms(uint32_t ms) { delayed_ms += ms; }
+  static void command(uint8_t cmd) { bursts.push_back({ true, { cmd } }); }
+  static void data(const uint8_t *bytes, uint32_t len) { bursts.push_back({ false, { bytes, bytes + len } }); }
+  static void pixels_msb_first(const uint16_t *pixels, uint32_t count) {
+    Burst burst = { false, {} };
+    for (uint32_t i = 0; i < count; i++) {
+      burst.bytes.push_back(pixels[i] >> 8);
+      burst.bytes.push_back(pixels[i] & 0xFF);
+    }
+    bursts.push_back(burst);
+  }
+};
+
+static int failures;
+
+static void expect(bool ok, const char *panel, const char *what) {
+  if (!ok) {
+    fprintf(stderr, "%s: %s\n", panel, what);
+    failures++;
+  }
+}
+
+// Argument bytes sent right after the last occurrence of `cmd`
+static std::vector<uint8_t> args_of(uint8_t cmd) {
+  for (size_t i = bursts.size(); i-- > 1;) {
+    if (bursts[i - 1].command && bursts[i - 1].bytes[0] == cmd && !bursts[i].command) {
+      return bursts[i].bytes;
+    }
+  }
+  return {};
+}
+
+template <typename Config>
+static void check(const char *name) {
+  using Driver = PanelDriver<Config, MockBus<Config>>;
+  using Controller = typename Config::Controller;
+
+  Driver::init();
+  expect(bursts.front().command && bursts.front().bytes[0] == Controller::SLPOUT, name, "init does not start with SLPOUT");
+  expect(bursts.back().command && bursts.back().bytes[0] == Controller::DISPON, name, "init does not end with DISPON");
+  expect(args_of(Controller::MADCTL) == std::vector<uint8_t>{ Config::madctl }, name, "MADCTL argument");
+  expect(args_of(Controller::COLMOD) == std::vector<uint8_t>{ Config::colmod }, name, "COLMOD argument");
+  expect(delayed_ms >= 120, name, "no sleep-out delay");
+
+  // Every command in the init sequence goes out with exactly its declared argument count
+  size_t commands = 0;
+  for (size_t i = 0; i + 1 < sizeof(Controller::init_sequence); commands++) {
+    i += 2 + (Controller::init_sequence[i + 1] & ~PANEL_SEQ_DELAY) +
+         ((Controller::init_sequence[i + 1] & PANEL_SEQ_DELAY) ? 1 : 0);
+  }
+  size_t sent = 0;
+  for (const Burst &burst : bursts) {
+    sent += burst.command;
+  }
+  expect(sent == commands + 5, name, "init sequence command count");   // + SLPOUT MADCTL COLMOD INV DISPON
+
+  bursts.clear();
+  Driver::set_window(1, 2, Config::width - 1, Config::height - 1);
+  const uint16_t xs = 1 + Config::offset_x, xe = Config::width - 1 + Config::offset_x;
+  const uint16_t ys = 2 + Config::offset_y, ye = Config::height - 1 + Config::offset_y;
+  expect(args_of(Controller::CASET) == std::vector<uint8_t>{ (uint8_t)(xs >> 8), (uint8_t)xs, (uint8_t)(xe >> 8), (uint8_t)xe },
+         name, "CASET window");
+  expect(args_of(Controller::RASET) == std::vector<uint8_t>{ (uint8_t)(ys >> 8), (uint8_t)ys, (uint8_t)(ye >> 8), (uint8_t)ye },
+         name, "RASET window");
+  expect(bursts.back().command && bursts.back().bytes[0] == Controller::RAMWR, name, "window does not end with RAMWR");
+
+  // The panel must receive 0xF800 (red) as F8 00 whatever the buffer's byte order
+  const uint16_t pixels[2] = { 0xF800, 0x001F };
+  bursts.clear();
+  Driver::write_pixels(pixels, 2);
+  std::vector<uint8_t> wire = bursts.back().bytes;
+  if (Controller::pixels_msb_first) {
+    expect(wire == std::vector<uint8_t>{ 0xF8, 0x00, 0x00, 0x1F }, name, "pixels not sent high byte first");
+  } else {
+    // Little-endian RAM mode: buffer order (host is little-endian like the ESP32)
+    expect(wire == std::vector<uint8_t>{ 0x00, 0xF8, 0x1F, 0x00 }, name, "pixels not sent in buffer order");
+  }
+
+  for (uint8_t rate = 0; rate < PANEL_RATE_COUNT; rate++) {
+    bursts.clear();
+    Driver::set_frame_rate((PanelRate)rate);
+    expect(!bursts.empty() && bursts.front().command && bursts.front().bytes[0] == Controller::rate_sequences[rate][0],
+           name, "frame rate sequence");
+  }
+
+  printf("%-16s %zu init commands, %ux%u, offset %u,%u, pixels %s\n", name, commands, Config::width, Config::height,
+         Config::offset_x, Config::offset_y, Controller::pixels_msb_first ? "high byte first" : "buffer order");
+}
+
+int main() {
+  check<ST7789_172x320>("ST7789 172x320");
+  check<ST7789_240x320>("ST7789 240x320");
+  check<ILI9341_240x320>("ILI9341 240x320");
+  if (failures) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All panel checks passed\n");
+  return 0;
+}
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""
+Host check for the /proc readers against page-at-a-time reads
+
+  python3 scripts/check_proc_reads.py
+
+Most /proc files are generated a record at a time, and one read() of them
+stops near a page boundary however large the buffer is. Fixture files are
+regular files that return everything at once and hide a reader that stops
+early, so this check caps every pread at one page while it reads fixture
+trees, then compares what the collector saw with the whole file. Real /proc
+files larger than a page are reread as well when the host has them.
+Exits non-zero on any mismatch.
+"""
+
+import contextlib
+import io
+import os
+import sys
+import tempfile
+import time
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+from pc_monitor import SystemMonitor  # noqa: E402
+from pc_monitor_fs import FsMonitor  # noqa: E402
+from pc_monitor_irq import IrqMonitor  # noqa: E402
+from pc_monitor_lowimpact import ProcReader, split_lines  # noqa: E402
+import make_fixture  # noqa: E402
+
+PAGE = 4096
+REAL_FILES = ('/proc/interrupts', '/proc/vmstat', '/proc/self/mountinfo', '/proc/net/dev')
+CPUS = 256                  # One /proc/interrupts row is ~2.8 KB at this width
+IFACES = 100                # ~7 KB of /proc/net/dev
+MOUNTS = 150                # ~14 KB of mountinfo, as on container hosts
+
+failures = 0
+
+
+def expect(ok: bool, what: str):
+    global failures
+    if not ok:
+        print(f"FAIL: {what}", file=sys.stderr)
+        failures += 1
+
+
+@contextlib.contextmanager
+def page_reads():
+    """Make every pread return at most one page, as seq_file does"""
+    preadv = os.preadv
+
+    def short_preadv(fd, buffers, offset):
+        return preadv(fd, [memoryview(buffers[0])[:PAGE]], offset)
+
+    os.preadv = short_preadv
+    try:
+        yield
+    finally:
+        os.preadv = preadv
+
+
+def whole(path: str) -> bytes:
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def check_reader(root: str):
+    path = os.path.join(root, 'table')
+    content = b''.join(b'%5d: %s\n' % (i, b'x' * (i % 90)) for i in range(3000))
+    with open(path, 'wb') as f:
+        f.write(content)
+
+    with page_reads():
+        reader = ProcReader(path, size=64)
+        first = reader.read()
+        expect(first == content, f"ProcReader stops at {len(first)} of {len(content)} bytes on page reads")
+        kept = bytes(first[:PAGE])
+        expect(reader.read() == content, "second read differs from the file")
+        expect(kept == content[:PAGE], "growing the buffer changed a view handed out earlier")
+        reader.close()
+
+        head = ProcReader(path, limit=256)
+        expect(head.read() == content[:256], "limit does not stop at the head of the file")
+        head.close()
+
+    for path in REAL_FILES:
+        try:
+            expected = len(split_lines(whole(path)))
+        except OSError:
+            continue
+        if expected and len(whole(path)) > PAGE:
+            reader = ProcReader(path)
+            got = len(split_lines(reader.read()))
+            reader.close()
+            expect(got == expected, f"{path}: {got} of {expected} lines")
+            print(f"{path:<24} {expected} lines read whole")
+
+
+def check_irq(root: str):
+    make_fixture.write_interrupts(root, CPUS, 1)
+    path = os.path.join(root, 'proc/interrupts')
+    rows = len(split_lines(whole(path))) - 1
+
+    with page_reads():
+        monitor = IrqMonitor(path, os.path.join(root, 'proc/softirqs'), budget_ms=1000.0)
+        monitor.sample()
+        expect(len(monitor.interrupts.rows) == rows,
+               f"/proc/interrupts: {len(monitor.interrupts.rows)} of {rows} rows parsed")
+        for tick in (2, 3):
+            time.sleep(0.05)
+            make_fixture.write_interrupts(root, CPUS, tick)
+            if tick == 3:
+                # Storm on the last active line, far past the first page (idle lines have no baseline yet)
+                last = [row.label for row in monitor.interrupts.rows if row.label.isdigit() and row.rate][-1]
+                lines = whole(path).split(b'\n')
+                index = next(i for i, line in enumerate(lines) if line.split(b':')[0].strip() == last.encode())
+                head, _, cells = lines[index].partition(b':')
+                lines[index] = head + b':' + b'%10d' % 999999999 + cells[10:]
+                with open(path, 'wb') as f:
+                    f.write(b'\n'.join(lines))
+            result = monitor.sample()
+        monitor.close()
+
+    expect(result.get('storm_source') is not None and result['top'][0][0].startswith(last + ':'),
+           f"storm on IRQ {last} not seen (top {result.get('top')})")
+    print(f"/proc/interrupts         {rows} rows of {CPUS} CPUs, storm injected on IRQ {last}")
+
+
+def check_network(root: str):
+    scale = {'cpus': 4, 'pids': 1, 'hwmon': 1, 'disks': 1, 'ifaces': IFACES}
+    make_fixture.build(root, scale)
+    path = os.path.join(root, 'proc/net/dev')
+    ifaces = [line.split(b':')[0].strip().decode() for line in split_lines(whole(path))[2:]]
+    ifaces.remove('lo')
+
+    with page_reads(), contextlib.redirect_stdout(io.StringIO()):
+        monitor = SystemMonitor(net_include=['*'], root=root)
+        monitor.get_network_speed()
+        time.sleep(0.05)
+        make_fixture.advance(root, scale, 2)
+        monitor.get_network_speed()
+
+    seen = sorted(monitor.net_windows)
+    expect(seen == sorted(ifaces), f"/proc/net/dev: {len(seen)} of {len(ifaces)} interfaces tracked")
+    # Traffic grows with the line number, so the last interface is the busiest
+    expect(monitor.net_busiest_iface == ifaces[-1],
+           f"busiest interface {monitor.net_busiest_iface}, expected {ifaces[-1]}")
+    print(f"/proc/net/dev            {len(seen)} interfaces, busiest {monitor.net_busiest_iface}")
+
+
+def check_mounts(root: str):
+    path = os.path.join(root, 'mountinfo')
+    mounts = [f'/var/lib/containers/volume{i:03d}' for i in range(MOUNTS)]
+    with open(path, 'w') as f:
+        for i, mount in enumerate(mounts):
+            f.write(f"{100 + i} 1 259:{i} / {mount} rw,relatime shared:{i + 1} - ext4 /dev/nvme0n1p{i + 1} rw\n")
+
+    with page_reads():
+        monitor = FsMonitor(path, lambda mount: root)
+        usage = monitor.sample().get('filesystems', {})
+        monitor.close()
+
+    expect(monitor.filesystems == mounts, f"mountinfo: {len(monitor.filesystems)} of {MOUNTS} mounts tracked")
+    expect(mounts[-1] in usage, f"no usage for {mounts[-1]}")
+    print(f"mountinfo                {len(monitor.filesystems)} mounts tracked, {os.path.getsize(path)} bytes")
+
+
+def check_vmstat(root: str):
+    scale = {'cpus': 4, 'pids': 1, 'hwmon': 1, 'disks': 1, 'ifaces': 1}
+    make_fixture.build(root, scale)
+    path = os.path.join(root, 'proc/vmstat')
+
+    def write(pswpin: int, pswpout: int, majflt: int):
+        # The watched counters sit after more than a page of other entries, as on recent kernels
+        filler = "".join(f"nr_zone_counter_{i} {i * 1000}\n" for i in range(300))
+        with open(path, 'w') as f:
+            f.write(f"{filler}pswpin {pswpin}\npswpout {pswpout}\npgfault 1\npgmajfault {majflt}\n")
+
+    with page_reads(), contextlib.redirect_stdout(io.StringIO()):
+        monitor = SystemMonitor(root=root)
+        write(1000, 2000, 3000)
+        monitor.get_vm_activity()
+        time.sleep(0.05)
+        write(1100, 2200, 3300)
+        rates = dict(monitor.get_vm_activity())
+        time.sleep(0.05)
+        write(0, 0, 0)      # Counter reset
+        reset = dict(monitor.get_vm_activity())
+
+    keys = ('swap_in_kbs', 'swap_out_kbs', 'major_faults')
+    expect(all(rates[key] > 0 for key in keys), f"/proc/vmstat counters past the first page read as 0: {rates}")
+    expect(all(reset[key] == 0 for key in keys), f"counter reset gives negative rates: {reset}")
+    print(f"/proc/vmstat             {os.path.getsize(path)} bytes, swap in {rates['swap_in_kbs']} KB/s")
+
+
+def main() -> int:
+    with tempfile.TemporaryDirectory(prefix='pcmon-check-') as root:
+        check_reader(root)
+        check_irq(root)
+        check_network(root)
+        check_mounts(root)
+        check_vmstat(root)
+    if failures:
+        print(f"{failures} check(s) failed", file=sys.stderr)
+        return 1
+    print("All /proc read checks passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""
+Flash/RAM footprint breakdown for the ESP32-C6 firmware
+Parses the GNU ld map file into per-subsystem totals, checks them against
+declared budgets and diffs them against a saved baseline
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from typing import Dict, List, Optional, Tuple
+
+# Subsystem classification rules, first match wins.
+# ('section', regex) matches the input section name (e.g. .bss.work_mem_int),
+# ('object', regex) matches the object/archive path the section came from.
+SUBSYSTEM_RULES: List[Tuple[str, str, str]] = [
+    ('draw_buffers',   'section', r'\.bss\.(_ZL4buf[12]|buf[12])$'),
+    ('lvgl_heap',      'section', r'\.bss\.work_mem_int$'),
+    ('fonts',          'object',  r'lv_font_[^/]*\.c\.o|ui_font_[^/]*\.c\.o'),
+    ('lvgl_core',      'object',  r'[/\\]lvgl[/\\]|liblvgl'),
+    ('ui',             'object',  r'[/\\]ui_[^/\\]*\.c\.o'),
+    ('display_driver', 'object',  r'Display_ST7789\.cpp\.o|LVGL_Driver\.cpp\.o'),
+    ('splash',         'object',  r'Splash_Image\.c\.o'),
+    ('metrics',        'object',  r'Metric_[^/\\]*\.cpp\.o'),
+    ('protocol',       'object',  r'[/\\]main\.cpp\.o|String_Dict\.cpp\.o|Frame_Recorder\.cpp\.o'),
+    ('link',           'object',  r'Serial_Mux\.cpp\.o'),
+    ('arduino_core',   'object',  r'FrameworkArduino|framework-arduinoespressif32'),
+    ('toolchain',      'object',  r'toolchain-|libgcc|libc\.a|libm\.a|libstdc\+\+'),
+]
+OTHER = 'other'
+
+_OUTPUT_SECTION_RE = re.compile(r'^(\.[^\s]+)(?:\s+0x[0-9a-fA-F]+\s+0x[0-9a-fA-F]+)?\s*$')
+_INPUT_SECTION_RE = re.compile(r'^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+_INPUT_NAME_ONLY_RE = re.compile(r'^ (\S+)$')
+_WRAPPED_ADDR_RE = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+
+
+def region_of(output_section: str) -> Tuple[bool, bool]:
+    """Return (counts_in_flash, counts_in_ram) for a linker output section"""
+    name = output_section.lower()
+    if 'debug' in name or name.startswith(('.comment', '.riscv.attributes', '.xt.', '.stab')):
+        return (False, False)
+    if 'bss' in name or 'noinit' in name:
+        return (False, True)
+    if 'rodata' in name or 'appdesc' in name or 'eh_frame' in name:
+        return (True, False)
+    if 'data' in name:
+        return (True, True)   # Initialised data: image in flash, copy in RAM
+    if 'iram' in name or 'rtc.text' in name or 'force_fast' in name:
+        return (True, True)   # Code loaded from flash into internal RAM at boot
+    if 'text' in name:
+        return (True, False)
+    return (False, False)
+
+
+def classify(section: str, obj: str) -> str:
+    """Map an input section to its subsystem"""
+    for subsystem, kind, pattern in SUBSYSTEM_RULES:
+        target = section if kind == 'section' else obj
+        if re.search(pattern, target):
+            return subsystem
+    return OTHER
+
+
+def parse_map(path: str) -> Dict[str, Dict[str, int]]:
+    """Parse a GNU ld map file into {subsystem: {'flash': bytes, 'ram': bytes}}"""
+    totals: Dict[str, Dict[str, int]] = {}
+    in_memory_map = False
+    output_section = ''
+    pending_name: Optional[str] = None
+
+    def account(section: str, addr: int, size: int, obj: str):
+        if size == 0 or addr == 0:
+            return  # Discarded or non-allocated input
+        in_flash, in_ram = region_of(output_section)
+        if not in_flash and not in_ram:
+            return
+        entry = totals.setdefault(classify(section, obj), {'flash': 0, 'ram': 0})
+        if in_flash:
+            entry['flash'] += size
+        if in_ram:
+            entry['ram'] += size
+
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if not in_memory_map:
+                if line.startswith('Linker script and memory map'):
+                    in_memory_map = True
+                continue
+
+            if pending_name is not None:
+                m = _WRAPPED_ADDR_RE.match(line)
+                name, pending_name = pending_name, None
+                if m:
+                    account(name, int(m.group(1), 16), int(m.group(2), 16), m.group(3))
+                    continue
+
+            if not line.startswith(' '):
+                m = _OUTPUT_SECTION_RE.match(line)
+                if m:
+                    output_section = m.group(1)
+                continue
+
+            m = _INPUT_SECTION_RE.match(line)
+            if m:
+                account(m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4))
+                continue
+
+            m = _INPUT_NAME_ONLY_RE.match(line)
+            if m and m.group(1) != '*fill*':
+                pending_name = m.group(1)
+
+    return totals
+
+
+def parse_size(text: str) -> int:
+    """Parse a byte count with an optional K/M suffix (e.g. '48K')"""
+    text = text.strip().upper()
+    scale = 1
+    if text.endswith('K'):
+        scale, text = 1024, text[:-1]
+    elif text.endswith('M'):
+        scale, text = 1024 * 1024, text[:-1]
+    return int(float(text) * scale)
+
+
+def parse_budgets(entries: List[str]) -> Dict[str, Dict[str, int]]:
+    """Parse 'subsystem.region = size' entries into {subsystem: {region: bytes}}"""
+    budgets: Dict[str, Dict[str, int]] = {}
+    for entry in entries:
+        entry = entry.split(';', 1)[0].strip()
+        if not entry:
+            continue
+        try:
+            key, value = entry.split('=', 1)
+            subsystem, region = key.strip().split('.', 1)
+            if region not in ('flash', 'ram'):
+                raise ValueError(f"unknown region '{region}'")
+            budgets.setdefault(subsystem, {})[region] = parse_size(value)
+        except ValueError as e:
+            print(f"Warning: Ignoring budget entry '{entry}': {e}")
+    return budgets
+
+
+def _fmt_delta(delta: int) -> str:
+    return f"{delta:+d}" if delta else "0"
+
+
+def report(totals: Dict[str, Dict[str, int]],
+           budgets: Dict[str, Dict[str, int]],
+           baseline: Optional[Dict[str, Dict[str, int]]]) -> List[str]:
+    """Print the footprint table and return a list of budget violations"""
+    violations = []
+    subsystems = sorted(set(totals) | set(budgets) | set(baseline or {}),
+                        key=lambda s: -totals.get(s, {}).get('flash', 0))
+
+    header = f"{'Subsystem':<16}{'Flash':>10}{'Budget':>10}{'RAM':>10}{'Budget':>10}"
+    if baseline is not None:
+        header += f"{'dFlash':>10}{'dRAM':>10}"
+    print(header)
+    print('-' * len(header))
+
+    sum_flash = sum_ram = 0
+    for subsystem in subsystems:
+        used = totals.get(subsystem, {'flash': 0, 'ram': 0})
+        budget = budgets.get(subsystem, {})
+        sum_flash += used['flash']
+        sum_ram += used['ram']
+
+        row = f"{subsystem:<16}{used['flash']:>10}{budget.get('flash', '-'):>10}" \
+              f"{used['ram']:>10}{budget.get('ram', '-'):>10}"
+        if baseline is not None:
+            base = baseline.get(subsystem, {'flash': 0, 'ram': 0})
+            row += f"{_fmt_delta(used['flash'] - base.get('flash', 0)):>10}" \
+                   f"{_fmt_delta(used['ram'] - base.get('ram', 0)):>10}"
+
+        for region in ('flash', 'ram'):
+            if region in budget and used[region] > budget[region]:
+                violations.append(f"{subsystem}.{region}: {used[region]} > {budget[region]} bytes")
+                row += f"  OVER {region.upper()}"
+        print(row)
+
+    print('-' * len(header))
+    total_row = f"{'total':<16}{sum_flash:>10}{'':>10}{sum_ram:>10}{'':>10}"
+    if baseline is not None:
+        base_flash = sum(v.get('flash', 0) for v in baseline.values())
+        base_ram = sum(v.get('ram', 0) for v in baseline.values())
+        total_row += f"{_fmt_delta(sum_flash - base_flash):>10}{_fmt_delta(sum_ram - base_ram):>10}"
+    print(total_row)
+    return violations
+
+
+def run(map_path: str, budget_entries: List[str], baseline_path: Optional[str],
+        save_baseline: bool) -> int:
+    """Produce the report; returns a process exit code (1 on budget violation)"""
+    if not os.path.exists(map_path):
+        print(f"Error: Linker map not found: {map_path}")
+        return 1
+
+    totals = parse_map(map_path)
+    if not totals:
+        print(f"Error: No allocated sections found in {map_path}")
+        return 1
+
+    if save_baseline:
+        if not baseline_path:
+            print("Error: No baseline path given")
+            return 1
+        with open(baseline_path, 'w') as f:
+            json.dump(totals, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print(f"Saved footprint baseline to {baseline_path}")
+
+    baseline = None
+    if baseline_path and os.path.exists(baseline_path) and not save_baseline:
+        with open(baseline_path, 'r') as f:
+            baseline = json.load(f)
+    elif baseline_path and not save_baseline:
+        print(f"Info: No baseline at {baseline_path}; run the footprint-baseline target to create one.")
+
+    violations = report(totals, parse_budgets(budget_entries), baseline)
+    if violations:
+        print("\nFootprint budget exceeded:")
+        for violation in violations:
+            print(f"  {violation}")
+        return 1
+    return 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Per-subsystem flash/RAM footprint from a linker map")
+    parser.add_argument('map', help="Path to the linker map (firmware.map)")
+    parser.add_argument('--budget', action='append', default=[],
+                        help="Budget entry 'subsystem.flash|ram=SIZE' (repeatable, K/M suffix allowed)")
+    parser.add_argument('--baseline', help="Baseline JSON to diff against")
+    parser.add_argument('--save-baseline', action='store_true',
+                        help="Write the current breakdown to --baseline instead of diffing")
+    args = parser.parse_args()
+    return run(args.map, args.budget, args.baseline, args.save_baseline)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""
+Synthetic /proc and /sys fixture generator
+Builds a fake procfs/sysfs tree at production scale so SystemMonitor can be
+exercised with `--root` (or SystemMonitor(root=...)) without the hardware.
+advance() rewrites the counter files so successive samples see activity.
+"""
+
+import argparse
+import os
+import random
+import sys
+from typing import Dict
+
+DEFAULT_SCALE = {
+    'cpus': 256,
+    'pids': 4000,
+    'hwmon': 32,
+    'disks': 64,
+    'ifaces': 100,
+}
+
+
+def _write(root: str, path: str, content: str):
+    full = os.path.join(root, path.lstrip('/'))
+    os.makedirs(os.path.dirname(full), exist_ok=True)
+    with open(full, 'w') as f:
+        f.write(content)
+
+
+def _iface_name(i: int) -> str:
+    # Mix of physical, bond and VLAN style names
+    if i == 0:
+        return 'bond0'
+    if i % 10 == 0:
+        return f'bond0.{100 + i}'
+    return f'eth{i}' if i % 3 else f'ens{i}f0'
+
+
+def write_proc_stat(root: str, cpus: int, tick: int):
+    def line(name: str, scale: int) -> str:
+        base = tick * scale
+        # user nice system idle iowait irq softirq steal guest guest_nice
+        return (f"{name} {base * 30} {base} {base * 10} {base * 55} {base * 2} "
+                f"{base} {base} {base // 2} 0 0\n")
+
+    content = line('cpu', cpus)
+    for cpu in range(cpus):
+        content += line(f'cpu{cpu}', 1)
+    content += f"intr {tick * 1000 * cpus}\nctxt {tick * 5000 * cpus}\nbtime 1700000000\n"
+    content += f"processes {tick * 10}\nprocs_running {min(cpus, 8)}\nprocs_blocked 0\n"
+    _write(root, '/proc/stat', content)
+
+
+def write_vmstat(root: str, tick: int):
+    content = "nr_free_pages 1000000\nnr_dirty 2000\n"
+    content += f"pgpgin {tick * 4000}\npgpgout {tick * 9000}\npswpin {tick * 3}\npswpout {tick * 12}\n"
+    content += f"pgfault {tick * 50000}\npgmajfault {tick * 7}\nthp_fault_alloc 0\n"
+    _write(root, '/proc/vmstat', content)
+
+
+def write_throttle(root: str, tick: int):
+    # One package; its counter advances every few samples
+    _write(root, '/sys/devices/system/cpu/cpu0/thermal_throttle/package_throttle_count', f"{tick // 3}\n")
+
+
+# Idle states per core and their share of each second of fixture time
+IDLE_STATES = (('POLL', 0.001), ('C1', 0.05), ('C1E', 0.15), ('C6', 0.6))
+
+
+def write_cpuidle(root: str, cpus: int, tick: int):
+    for cpu in range(cpus):
+        for state, (name, share) in enumerate(IDLE_STATES):
+            # Odd cores sleep less deeply
+            us = int(tick * 1000000 * share * (0.5 if cpu % 2 and name == 'C6' else 1.0))
+            _write(root, f'/sys/devices/system/cpu/cpu{cpu}/cpuidle/state{state}/time', f"{us}\n")
+
+
+def write_interrupts(root: str, cpus: int, tick: int):
+    # Two MSI vectors per CPU (NIC queue and NVMe queue), each affine to one CPU; most stay idle
+    content = " " * 4 + "".join(f"{'CPU' + str(cpu):>11}" for cpu in range(cpus)) + "\n"
+    for irq in range(2 * cpus):
+        cpu = irq % cpus
+        active = irq % 8 == 0
+        cells = "".join(f"{(tick * (irq + 1) * 37 if active and c == cpu else 5):>10} " for c in range(cpus))
+        device = f"eth0-TxRx-{cpu}" if irq < cpus else f"nvme0q{cpu}"
+        content += f"{irq + 30:>3}: {cells} IR-PCI-MSI {irq}-edge      {device}\n"
+    content += "LOC: " + "".join(f"{tick * 1000:>10} " for _ in range(cpus)) + " Local timer interrupts\n"
+    content += "ERR:          0\n"
+    _write(root, '/proc/interrupts', content)
+
+    names = ('HI', 'TIMER', 'NET_TX', 'NET_RX', 'BLOCK', 'IRQ_POLL', 'TASKLET', 'SCHED', 'HRTIMER', 'RCU')
+    content = " " * 8 + "".join(f"{'CPU' + str(cpu):>11}" for cpu in range(cpus)) + "\n"
+    for i, name in enumerate(names):
+        content += f"{name:>12}:" + "".join(f" {tick * i * 11:>10}" for _ in range(cpus)) + "\n"
+    _write(root, '/proc/softirqs', content)
+
+
+def write_net_snmp(root: str, tick: int):
+    out_segs = tick * 20000
+    _write(root, '/proc/net/snmp',
+           "Ip: Forwarding DefaultTTL InReceives\nIp: 1 64 " + str(tick * 30000) + "\n"
+           "Tcp: RtoAlgorithm RtoMin RtoMax MaxConn ActiveOpens PassiveOpens AttemptFails EstabResets "
+           "CurrEstab InSegs OutSegs RetransSegs InErrs OutRsts InCsumErrors\n"
+           f"Tcp: 1 200 120000 -1 {tick * 40} {tick * 250} 0 {tick} 1200 {tick * 21000} {out_segs} "
+           f"{out_segs // 100} 0 {tick * 3} 0\n"
+           "Udp: InDatagrams NoPorts InErrors OutDatagrams\nUdp: 0 0 0 0\n")
+    _write(root, '/proc/net/netstat',
+           "TcpExt: SyncookiesSent SyncookiesRecv SyncookiesFailed ListenOverflows ListenDrops TCPTimeouts\n"
+           f"TcpExt: 0 0 0 {tick // 4} {tick // 4} {tick * 2}\n"
+           "IpExt: InNoRoutes InTruncatedPkts\nIpExt: 0 0\n")
+
+
+def write_net_dev(root: str, ifaces: int, tick: int):
+    content = ("Inter-|   Receive                                                |  Transmit\n"
+               " face |bytes    packets errs drop fifo frame compressed multicast|"
+               "bytes    packets errs drop fifo colls carrier compressed\n")
+    names = ['lo'] + [_iface_name(i) for i in range(ifaces)]
+    for i, name in enumerate(names):
+        rx = tick * (i + 1) * 125000
+        tx = tick * (i + 1) * 25000
+        content += (f"{name:>6}: {rx} {rx // 1500} 0 0 0 0 0 0 "
+                    f"{tx} {tx // 1500} 0 0 0 0 0 0\n")
+    _write(root, '/proc/net/dev', content)
+
+
+def write_diskstats(root: str, disks: int, tick: int):
+    content = ''
+    for d in range(disks):
+        name = f'nvme{d}n1'
+        reads = tick * (d + 1) * 100
+        content += (f" 259 {d} {name} {reads} 0 {reads * 8} {reads // 10} "
+                    f"{reads // 2} 0 {reads * 4} {reads // 20} 0 {reads // 5} {reads // 8}\n")
+    _write(root, '/proc/diskstats', content)
+
+
+def advance(root: str, scale: Dict[str, int], tick: int):
+    """Rewrite the monotonic counter files for sample number `tick`"""
+    write_proc_stat(root, scale['cpus'], tick)
+    write_vmstat(root, tick)
+    write_throttle(root, tick)
+    write_cpuidle(root, scale['cpus'], tick)
+    write_interrupts(root, scale['cpus'], tick)
+    write_net_snmp(root, tick)
+    write_net_dev(root, scale['ifaces'], tick)
+    write_diskstats(root, scale['disks'], tick)
+
+
+def build(root: str, scale: Dict[str, int], seed: int = 1):
+    """Create a complete fixture tree under root"""
+    rng = random.Random(seed)
+
+    # /proc
+    mem_kb = 512 * 1024 * 1024
+    _write(root, '/proc/meminfo',
+           f"MemTotal:       {mem_kb} kB\nMemFree:        {mem_kb // 4} kB\n"
+           f"MemAvailable:   {mem_kb // 2} kB\nBuffers:        {mem_kb // 64} kB\n"
+           f"Cached:         {mem_kb // 8} kB\nSwapCached:            0 kB\n"
+           f"SwapTotal:      {mem_kb // 16} kB\nSwapFree:       {mem_kb // 16} kB\n"
+           f"Dirty:              {rng.randint(100, 9000)} kB\nWriteback:             0 kB\n")
+    _write(root, '/proc/net/route',
+           "Iface\tDestination\tGateway \tFlags\tRefCnt\tUse\tMetric\tMask\n"
+           "bond0\t00000000\t0100A8C0\t0003\t0\t0\t0\t00000000\n")
+    for pid in range(1, scale['pids'] + 1):
+        comm = f"worker{pid % 97}"
+        _write(root, f'/proc/{pid}/stat',
+               f"{pid} ({comm}) S 1 {pid} {pid} 0 -1 4194560 {pid * 3} 0 0 0 "
+               f"{pid % 500} {pid % 200} 0 0 20 0 1 0 {pid * 10} 10485760 2560\n")
+        _write(root, f'/proc/{pid}/status', f"Name:\t{comm}\nState:\tS (sleeping)\nPid:\t{pid}\nVmRSS:\t10240 kB\n")
+    advance(root, scale, 1)
+
+    # CPU frequency
+    for cpu in range(scale['cpus']):
+        base = f'/sys/devices/system/cpu/cpu{cpu}/cpufreq'
+        _write(root, f'{base}/scaling_cur_freq', f"{rng.randint(1200000, 3800000)}\n")
+        _write(root, f'{base}/scaling_max_freq', "3800000\n")
+        _write(root, f'{base}/cpuinfo_max_freq', "3800000\n")
+        _write(root, f'/sys/devices/system/cpu/cpu{cpu}/topology/physical_package_id', "0\n")
+        _write(root, f'/sys/devices/system/cpu/cpu{cpu}/thermal_throttle/core_throttle_count', "0\n")
+        for state, (name, _) in enumerate(IDLE_STATES):
+            _write(root, f'/sys/devices/system/cpu/cpu{cpu}/cpuidle/state{state}/name', f"{name}\n")
+
+    # Two NUMA nodes splitting the CPUs and memory (single node below 2 CPUs)
+    nodes = 2 if scale['cpus'] >= 2 else 1
+    per_node = scale['cpus'] // nodes
+    for node in range(nodes):
+        first = node * per_node
+        last = scale['cpus'] - 1 if node == nodes - 1 else first + per_node - 1
+        node_kb = mem_kb // nodes
+        base = f'/sys/devices/system/node/node{node}'
+        _write(root, f'{base}/cpulist', f"{first}-{last}\n")
+        _write(root, f'{base}/meminfo',
+               f"Node {node} MemTotal:       {node_kb} kB\nNode {node} MemFree:        {node_kb // (4 + node * 4)} kB\n"
+               f"Node {node} MemUsed:        {node_kb - node_kb // (4 + node * 4)} kB\n"
+               f"Node {node} FilePages:      {node_kb // 8} kB\n")
+
+    # hwmon: the first one is k10temp, the rest generic sensors with fans
+    for h in range(scale['hwmon']):
+        base = f'/sys/class/hwmon/hwmon{h}'
+        _write(root, f'{base}/name', "k10temp\n" if h == 0 else f"nct{6700 + h}\n")
+        _write(root, f'{base}/temp1_input', f"{rng.randint(35000, 85000)}\n")
+        if h:
+            _write(root, f'{base}/fan1_input', f"{rng.randint(600, 2400)}\n")
+
+    # Block devices, the first mounted on / and the rest under /mnt, plus mounts the collector skips
+    mountinfo = ("22 1 0:21 / /proc rw,nosuid,nodev,noexec,relatime shared:12 - proc proc rw\n"
+                 "25 1 0:23 / /run rw,nosuid,nodev shared:5 - tmpfs tmpfs rw,mode=755\n"
+                 "40 1 7:0 / /snap/core/1 ro,nodev,relatime shared:20 - squashfs /dev/loop0 ro\n")
+    for d in range(scale['disks']):
+        _write(root, f'/sys/block/nvme{d}n1/size', f"{rng.randint(1, 8) * 1953525168}\n")
+        mount_point = '/' if d == 0 else f'/mnt/nvme{d}'
+        os.makedirs(os.path.join(root, mount_point.lstrip('/')), exist_ok=True)
+        mountinfo += (f"{30 + d} 1 259:{d} / {mount_point} rw,relatime shared:{d + 1} - "
+                      f"ext4 /dev/nvme{d}n1 rw,errors=remount-ro\n")
+    _write(root, '/proc/self/mountinfo', mountinfo)
+
+    # Network interfaces
+    for i in range(scale['ifaces']):
+        base = f'/sys/class/net/{_iface_name(i)}'
+        _write(root, f'{base}/operstate', "up\n")
+        _write(root, f'{base}/speed', "25000\n" if i == 0 else "10000\n")
+    _write(root, '/sys/class/net/lo/operstate', "unknown\n")
+
+    # GPU and battery
+    _write(root, '/sys/class/drm/card0/device/gpu_busy_percent', f"{rng.randint(0, 100)}\n")
+    _write(root, '/sys/class/power_supply/BAT0/capacity', "87\n")
+    _write(root, '/sys/class/power_supply/BAT0/power_now', "12500000\n")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Generate a synthetic /proc and /sys tree")
+    parser.add_argument('root', help="Output directory")
+    for name, default in DEFAULT_SCALE.items():
+        parser.add_argument(f'--{name}', type=int, default=default, help=f"Number of {name} (default {default})")
+    args = parser.parse_args()
+
+    scale = {name: getattr(args, name) for name in DEFAULT_SCALE}
+    build(args.root, scale)
+    print(f"Fixture written to {args.root}: " + ", ".join(f"{k}={v}" for k, v in scale.items()))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
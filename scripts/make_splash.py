@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""
+Boot splash generator
+Converts a landscape PNG from assets/ into the compressed RGB565 stream
+decoded by include/Splash_Decoder.h and writes it as src/Splash_Image.c.
+Pixels are rotated into panel-native portrait order (LVGL's LV_DISP_ROT_270)
+so the firmware can stream scanlines straight to the panel.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+from typing import List, Tuple
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_ASSET = os.path.join(PROJECT_DIR, 'assets', 'splash.png')
+DEFAULT_OUTPUT = os.path.join(PROJECT_DIR, 'src', 'Splash_Image.c')
+
+# Must match include/Splash_Decoder.h
+MAGIC = b'S565'
+INDEX_SIZE = 64
+OP_RUN = 0x00
+OP_INDEX = 0x40
+OP_LONG_RUN = 0x80
+OP_LITERAL = 0xFF
+SHORT_RUN = 64
+LONG_RUN = SHORT_RUN + (1 << 14)
+
+Image = Tuple[int, int, List[Tuple[int, int, int]]]   # width, height, RGB pixels row-major
+
+
+def read_png(path: str) -> Image:
+    """Minimal PNG reader: 8-bit grayscale, RGB or RGBA, non-interlaced (alpha is dropped)"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError(f"{path}: not a PNG file")
+
+    pos = 8
+    idat = b''
+    width = height = channels = 0
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', body)
+            channels = {0: 1, 2: 3, 6: 4}.get(color_type, 0)
+            if depth != 8 or not channels or interlace:
+                raise ValueError(f"{path}: only 8-bit gray/RGB/RGBA non-interlaced PNGs are supported")
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows: List[bytearray] = []
+    prev = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind, line = raw[start], bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            pixels.append((px[0], px[0], px[0]) if channels == 1 else (px[0], px[1], px[2]))
+    return width, height, pixels
+
+
+def rgb565(r: int, g: int, b: int) -> int:
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def to_native(image: Image) -> Tuple[int, int, List[int]]:
+    """Landscape image -> panel-native portrait RGB565 scanlines
+
+    With LV_DISP_ROT_270 LVGL maps logical (x, y) to native (W - 1 - y, x),
+    where W is the native width (the logical height).
+    """
+    width, height, pixels = image
+    native = []
+    for ny in range(width):
+        for nx in range(height):
+            native.append(rgb565(*pixels[(height - 1 - nx) * width + ny]))
+    return height, width, native
+
+
+def splash_hash(color: int) -> int:
+    return ((color >> 11) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) % INDEX_SIZE
+
+
+def encode(width: int, height: int, pixels: List[int], background: int) -> bytes:
+    out = bytearray(MAGIC + struct.pack('<HHH', width, height, background))
+    index = [0] * INDEX_SIZE
+    prev = background
+    run = 0
+
+    def flush_run():
+        nonlocal run
+        while run:
+            if run > SHORT_RUN:
+                n = min(run, LONG_RUN) - SHORT_RUN - 1
+                out.extend((OP_LONG_RUN | (n >> 8), n & 0xFF))
+                run -= n + SHORT_RUN + 1
+            else:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+
+    for color in pixels:
+        if color == prev:
+            run += 1
+            continue
+        flush_run()
+        slot = splash_hash(color)
+        if index[slot] == color:
+            out.append(OP_INDEX | slot)
+        else:
+            index[slot] = color
+            out.append(OP_LITERAL)
+            out.extend(struct.pack('<H', color))
+        prev = color
+    flush_run()
+    return bytes(out)
+
+
+def decode(data: bytes) -> Tuple[int, int, List[int]]:
+    """Reference decoder, used to verify the encoder output"""
+    if data[:4] != MAGIC:
+        raise ValueError("bad magic")
+    width, height, background = struct.unpack('<HHH', data[4:10])
+    index = [0] * INDEX_SIZE
+    prev = background
+    pixels: List[int] = []
+    pos = 10
+    while len(pixels) < width * height:
+        op = data[pos]
+        pos += 1
+        if op & 0xC0 == OP_RUN:
+            pixels.extend([prev] * ((op & 0x3F) + 1))
+        elif op & 0xC0 == OP_INDEX:
+            prev = index[op & 0x3F]
+            pixels.append(prev)
+        elif op & 0xC0 == OP_LONG_RUN:
+            pixels.extend([prev] * ((((op & 0x3F) << 8) | data[pos]) + SHORT_RUN + 1))
+            pos += 1
+        else:
+            prev = data[pos] | (data[pos + 1] << 8)
+            pos += 2
+            index[splash_hash(prev)] = prev
+            pixels.append(prev)
+    return width, height, pixels
+
+
+def write_source(path: str, data: bytes, asset: str, width: int, height: int):
+    lines = [
+        f"// Generated by scripts/make_splash.py from {os.path.relpath(asset, PROJECT_DIR)}; do not edit.",
+        f"// {width}x{height} panel-native RGB565, {len(data)} bytes (raw {width * height * 2})",
+        '#include "Splash_Image.h"',
+        "",
+        "const uint8_t splash_image[] = {",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("  " + " ".join(f"0x{b:02X}," for b in data[i:i + 16]))
+    lines += ["};", "", "const uint32_t splash_image_len = sizeof(splash_image);", ""]
+    with open(path, 'w') as f:
+        f.write("\n".join(lines))
+
+
+def build(asset: str, output: str) -> bytes:
+    width, height, pixels = to_native(read_png(asset))
+    background = max(set(pixels), key=pixels.count)
+    data = encode(width, height, pixels, background)
+    if decode(data)[2] != pixels:
+        raise RuntimeError("splash encoder round trip failed")
+    write_source(output, data, asset, width, height)
+    return data
+
+
+def build_if_stale(asset: str = DEFAULT_ASSET, output: str = DEFAULT_OUTPUT) -> bool:
+    """Regenerate the image source when the asset or this script is newer; returns True if rebuilt"""
+    if not os.path.exists(asset):
+        return False
+    newest = max(os.path.getmtime(asset), os.path.getmtime(__file__))
+    if os.path.exists(output) and os.path.getmtime(output) >= newest:
+        return False
+    build(asset, output)
+    return True
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Generate the compressed boot splash")
+    parser.add_argument('asset', nargs='?', default=DEFAULT_ASSET, help="Landscape PNG (default assets/splash.png)")
+    parser.add_argument('-o', '--output', default=DEFAULT_OUTPUT, help="C source to write (default src/Splash_Image.c)")
+    args = parser.parse_args()
+
+    data = build(args.asset, args.output)
+    width, height = struct.unpack('<HH', data[4:8])
+    raw = width * height * 2
+    print(f"Splash {width}x{height}: {len(data)} bytes flash, raw {raw} bytes ({raw / len(data):.1f}x)")
+    print(f"Written to {args.output}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,57 @@
+"""
+PlatformIO extra script: emits a linker map and registers footprint targets
+
+    pio run -t footprint            # per-subsystem report, fails when over budget
+    pio run -t footprint-baseline   # save the current breakdown as the baseline
+
+Budgets come from `custom_footprint_budgets` and the baseline path from
+`custom_footprint_baseline` in platformio.ini
+"""
+
+import os
+import sys
+
+Import("env")
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "scripts"))
+import footprint  # noqa: E402
+
+MAP_PATH = os.path.join(env.subst("$BUILD_DIR"), "firmware.map")
+env.Append(LINKFLAGS=[f"-Wl,-Map={MAP_PATH}"])
+
+
+def _option(name: str, default: str = "") -> str:
+    try:
+        return env.GetProjectOption(name)
+    except Exception:
+        return default
+
+
+def _budgets():
+    return [line for line in _option("custom_footprint_budgets").splitlines() if line.strip()]
+
+
+def _baseline_path() -> str:
+    path = _option("custom_footprint_baseline", "footprint_baseline.json")
+    return os.path.join(env.subst("$PROJECT_DIR"), path)
+
+
+def _run_footprint(save_baseline: bool) -> int:
+    return footprint.run(MAP_PATH, _budgets(), _baseline_path(), save_baseline)
+
+
+env.AddCustomTarget(
+    name="footprint",
+    dependencies="$BUILD_DIR/${PROGNAME}.elf",
+    actions=[lambda target, source, env: _run_footprint(False)],
+    title="Footprint",
+    description="Per-subsystem flash/RAM report with budget and baseline check",
+)
+
+env.AddCustomTarget(
+    name="footprint-baseline",
+    dependencies="$BUILD_DIR/${PROGNAME}.elf",
+    actions=[lambda target, source, env: _run_footprint(True)],
+    title="Footprint Baseline",
+    description="Save the current footprint breakdown as the baseline",
+)
@@ -0,0 +1,15 @@
+"""
+PlatformIO extra script: regenerates src/Splash_Image.c from
+assets/splash.png before the build when the asset (or generator) changed
+"""
+
+import os
+import sys
+
+Import("env")
+
+sys.path.insert(0, os.path.join(env.subst("$PROJECT_DIR"), "scripts"))
+import make_splash  # noqa: E402
+
+if make_splash.build_if_stale():
+    print("Splash: regenerated src/Splash_Image.c from assets/splash.png")
@@ -0,0 +1,96 @@
+#include "Frame_Recorder.h"
+#include <esp_attr.h>
+
+#define RECORDER_MAGIC 0x42424F58   // "BBOX"
+
+static RTC_NOINIT_ATTR FrameRecorder recorder;
+
+void Recorder_Init(bool power_on)
+{
+  if (power_on || recorder.magic != RECORDER_MAGIC ||
+      recorder.head >= RECORDER_FRAMES || recorder.count > RECORDER_FRAMES) {
+    memset(&recorder, 0, sizeof(recorder));
+    recorder.magic = RECORDER_MAGIC;
+    return;
+  }
+  recorder.boot++;
+}
+
+void Recorder_Push(const char *line, size_t len, FrameResult result)
+{
+  RecordedFrame &f = recorder.frames[recorder.head];
+
+  if (len > RECORDER_FRAME_LEN) len = RECORDER_FRAME_LEN;
+  f.ms = millis();
+  f.boot = recorder.boot;
+  f.result = result;
+  f.len = (uint8_t)len;
+  memcpy(f.data, line, len);
+
+  recorder.head = (recorder.head + 1) % RECORDER_FRAMES;
+  if (recorder.count < RECORDER_FRAMES) recorder.count++;
+}
+
+// Split a recorded line at commas into at most RECORDER_MAX_FIELDS (start, length) pairs;
+// the last field keeps any remaining text
+static uint8_t split_fields(const RecordedFrame &f, uint8_t *start, uint8_t *length)
+{
+  uint8_t n = 0;
+  uint8_t begin = 0;
+  for (uint8_t i = 0; i <= f.len; i++) {
+    if (i == f.len || (f.data[i] == ',' && n < RECORDER_MAX_FIELDS - 1)) {
+      start[n] = begin;
+      length[n] = i - begin;
+      n++;
+      begin = i + 1;
+    }
+  }
+  return n;
+}
+
+void Recorder_Dump(Print &out)
+{
+  uint8_t start[2][RECORDER_MAX_FIELDS];
+  uint8_t length[2][RECORDER_MAX_FIELDS];
+  uint8_t fields[2] = { 0, 0 };
+  const RecordedFrame *prev = NULL;
+
+  out.printf("DUMP:%u,%u,%lu\n", recorder.boot, recorder.count, (unsigned long)millis());
+
+  uint16_t slot = (recorder.head + RECORDER_FRAMES - recorder.count) % RECORDER_FRAMES;
+  for (uint16_t n = 0; n < recorder.count; n++, slot = (slot + 1) % RECORDER_FRAMES) {
+    const RecordedFrame &f = recorder.frames[slot];
+    uint8_t cur = n & 1;
+    uint8_t last = cur ^ 1;
+    uint32_t dt = f.ms;
+
+    // A new boot restarts the timeline and the diff base
+    if (!prev || prev->boot != f.boot) {
+      out.printf("BOOT:%u\n", f.boot);
+      prev = NULL;
+    } else {
+      dt = f.ms - prev->ms;
+    }
+
+    fields[cur] = split_fields(f, start[cur], length[cur]);
+    uint32_t mask = 0;
+    for (uint8_t i = 0; prev && i < fields[cur] && i < fields[last]; i++) {
+      if (length[cur][i] == length[last][i] &&
+          memcmp(f.data + start[cur][i], prev->data + start[last][i], length[cur][i]) == 0) {
+        mask |= 1UL << i;
+      }
+    }
+
+    out.printf("D:%lu,%u,%u,%lx|", (unsigned long)dt, f.result, fields[cur], (unsigned long)mask);
+    bool first = true;
+    for (uint8_t i = 0; i < fields[cur]; i++) {
+      if (mask & (1UL << i)) continue;
+      if (!first) out.write(',');
+      out.write((const uint8_t *)f.data + start[cur][i], length[cur][i]);
+      first = false;
+    }
+    out.write('\n');
+    prev = &f;
+  }
+  out.println("DUMP:END");
+}
@@ -9,6 +9,7 @@
 static lv_disp_draw_buf_t draw_buf;
 static lv_color_t buf1[ LVGL_BUF_LEN ];
 static lv_color_t buf2[ LVGL_BUF_LEN ];
+static uint16_t refresh_count = 0;   // Completed LVGL refreshes in the current second
 // static lv_color_t* buf1 = (lv_color_t*) heap_caps_malloc(LVGL_BUF_LEN, MALLOC_CAP_SPIRAM);
 // static lv_color_t* buf2 = (lv_color_t*) heap_caps_malloc(LVGL_BUF_LEN, MALLOC_CAP_SPIRAM);
     
@@ -28,6 +29,9 @@ void Lvgl_print(const char * buf)
 void Lvgl_Display_LCD( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p )
 {
   LCD_addWindow(area->x1, area->y1, area->x2, area->y2, ( uint16_t *)&color_p->full);
+  if (lv_disp_flush_is_last(disp_drv)) {
+    refresh_count++;
+  }
   lv_disp_flush_ready( disp_drv );
 }
 /*Read the touchpad*/
@@ -66,11 +70,6 @@ void Lvgl_Init(void)
   indev_drv.read_cb = Lvgl_Touchpad_Read;
   lv_indev_drv_register( &indev_drv );
 
-  /* Create simple label */
-  lv_obj_t *label = lv_label_create( lv_scr_act() );
-  lv_label_set_text( label, "Hello Ardino and LVGL!");
-  lv_obj_align( label, LV_ALIGN_CENTER, 0, 0 );
-
   const esp_timer_create_args_t lvgl_tick_timer_args = {
     .callback = &example_increase_lvgl_tick,
     .name = "lvgl_tick"
@@ -84,4 +83,40 @@ void Timer_Loop(void)
 {
   lv_timer_handler(); /* let the GUI do its work */
   // delay( 5 );
-}
\ No newline at end of file
+}
+
+/*  Panel frame rate
+    Running animations, or more than PANEL_ACTIVE_REFRESHES redraws in a
+    second (page changes), select the active rate. Once the content has been
+    static for PANEL_ACTIVE_HOLD_MS the panel drops to the static rate, and
+    to the power-save rate while disconnected.
+*/
+void Lvgl_Adapt_Frame_Rate(bool power_save)
+{
+  static PanelRate current = PANEL_RATE_ACTIVE;   // Rate set by the init sequence
+  static unsigned long window_start = 0;
+  static unsigned long last_active = 0;
+  unsigned long now = millis();
+
+  if (lv_anim_count_running() > 0) {
+    last_active = now;
+  }
+  if (now - window_start >= 1000) {
+    if (refresh_count >= PANEL_ACTIVE_REFRESHES) {
+      last_active = now;
+    }
+    refresh_count = 0;
+    window_start = now;
+  }
+
+  PanelRate rate = PANEL_RATE_STATIC;
+  if (power_save) {
+    rate = PANEL_RATE_POWER_SAVE;
+  } else if (now - last_active < PANEL_ACTIVE_HOLD_MS) {
+    rate = PANEL_RATE_ACTIVE;
+  }
+  if (rate != current) {
+    LCD_SetFrameRate(rate);
+    current = rate;
+  }
+}
@@ -0,0 +1,135 @@
+#include "Metric_History.h"
+
+MetricHistory cpuHistory;
+MetricHistory tempHistory;
+
+static const uint16_t tier_len[HISTORY_TIERS] = { HISTORY_T0_LEN, HISTORY_T1_LEN, HISTORY_T2_LEN };
+static const uint16_t tier_seconds[HISTORY_TIERS] = { 1, HISTORY_T1_SECONDS, HISTORY_T2_SECONDS };
+
+static inline uint8_t quantize(float value)
+{
+  float half_units = value * 2.0f + 0.5f;
+  if (half_units < 0.0f) return 0;
+  if (half_units > HISTORY_NO_DATA - 1) return HISTORY_NO_DATA - 1;
+  return (uint8_t)half_units;
+}
+
+static inline void accum_reset(HistoryAccum &acc)
+{
+  acc.min = HISTORY_NO_DATA;
+  acc.max = 0;
+  acc.sum = 0;
+  acc.count = 0;
+  acc.ticks = 0;
+}
+
+static inline void accum_add(HistoryAccum &acc, uint8_t lo, uint8_t hi, uint8_t avg)
+{
+  acc.ticks++;
+  if (avg == HISTORY_NO_DATA) return;
+  if (lo < acc.min) acc.min = lo;
+  if (hi > acc.max) acc.max = hi;
+  acc.sum += avg;
+  acc.count++;
+}
+
+static inline HistoryBucket accum_bucket(const HistoryAccum &acc)
+{
+  HistoryBucket b = { HISTORY_NO_DATA, HISTORY_NO_DATA, HISTORY_NO_DATA };
+  if (acc.count) {
+    b.min = acc.min;
+    b.max = acc.max;
+    b.avg = (uint8_t)((acc.sum + acc.count / 2) / acc.count);
+  }
+  return b;
+}
+
+void History_Init(MetricHistory &h)
+{
+  memset(&h, HISTORY_NO_DATA, sizeof(h));
+  h.t0_head = h.t1_head = h.t2_head = 0;
+  accum_reset(h.acc1);
+  accum_reset(h.acc2);
+}
+
+static void push_sample(MetricHistory &h, uint8_t q)
+{
+  h.t0[h.t0_head] = q;
+  h.t0_head = (h.t0_head + 1) % HISTORY_T0_LEN;
+
+  accum_add(h.acc1, q, q, q);
+  if (h.acc1.ticks < HISTORY_T1_SECONDS) return;
+
+  HistoryBucket b1 = accum_bucket(h.acc1);
+  accum_reset(h.acc1);
+  h.t1[h.t1_head] = b1;
+  h.t1_head = (h.t1_head + 1) % HISTORY_T1_LEN;
+
+  accum_add(h.acc2, b1.min, b1.max, b1.avg);
+  if (h.acc2.ticks < HISTORY_T2_SECONDS / HISTORY_T1_SECONDS) return;
+
+  h.t2[h.t2_head] = accum_bucket(h.acc2);
+  accum_reset(h.acc2);
+  h.t2_head = (h.t2_head + 1) % HISTORY_T2_LEN;
+}
+
+void History_Push(MetricHistory &h, float value)
+{
+  push_sample(h, quantize(value));
+}
+
+void History_PushGap(MetricHistory &h)
+{
+  push_sample(h, HISTORY_NO_DATA);
+}
+
+uint8_t History_TierForSpan(uint32_t span_s)
+{
+  for (uint8_t tier = 0; tier < HISTORY_TIERS; tier++) {
+    if (span_s <= (uint32_t)tier_len[tier] * tier_seconds[tier]) return tier;
+  }
+  return HISTORY_TIERS - 1;
+}
+
+uint16_t History_TierSeconds(uint8_t tier)
+{
+  return tier_seconds[tier < HISTORY_TIERS ? tier : HISTORY_TIERS - 1];
+}
+
+static inline uint8_t tier_avg(const MetricHistory &h, uint8_t tier, uint16_t idx)
+{
+  switch (tier) {
+    case 0:  return h.t0[idx];
+    case 1:  return h.t1[idx].avg;
+    default: return h.t2[idx].avg;
+  }
+}
+
+void History_Read(const MetricHistory &h, uint32_t span_s, uint8_t *out, uint16_t points)
+{
+  const uint8_t tier = History_TierForSpan(span_s);
+  const uint16_t len = tier_len[tier];
+  const uint16_t head = tier == 0 ? h.t0_head : (tier == 1 ? h.t1_head : h.t2_head);
+
+  uint32_t samples = span_s / tier_seconds[tier];
+  if (samples > len) samples = len;
+  if (samples == 0) samples = 1;
+
+  const uint16_t oldest = (head + len - samples) % len;
+  for (uint16_t p = 0; p < points; p++) {
+    // Samples [first, last) of the span map onto output point p
+    uint32_t first = (uint32_t)p * samples / points;
+    uint32_t last = (uint32_t)(p + 1) * samples / points;
+    if (last <= first) last = first + 1;
+
+    uint32_t sum = 0, count = 0;
+    for (uint32_t i = first; i < last; i++) {
+      uint8_t v = tier_avg(h, tier, (oldest + i) % len);
+      if (v != HISTORY_NO_DATA) {
+        sum += v;
+        count++;
+      }
+    }
+    out[p] = count ? (uint8_t)((sum + count / 2) / count) : HISTORY_NO_DATA;
+  }
+}
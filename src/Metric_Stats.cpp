@@ -0,0 +1,94 @@
+#include "Metric_Stats.h"
+
+MetricStats metricStats[STATS_METRICS];
+
+static inline int16_t to_x10(float v)
+{
+  float scaled = v * 10.0f;
+  if (scaled > 32767.0f) return 32767;
+  if (scaled < -32768.0f) return -32768;
+  return (int16_t)(scaled + (scaled >= 0.0f ? 0.5f : -0.5f));
+}
+
+static inline uint8_t bucket_of(const MetricStats &s, int16_t v_x10)
+{
+  int32_t idx = ((int32_t)v_x10 - s.lo_x10) / s.bucket_x10;
+  if (idx < 0) return 0;
+  if (idx >= STATS_BUCKETS) return STATS_BUCKETS - 1;
+  return (uint8_t)idx;
+}
+
+// Midpoint of a bucket, clamped to the session range so a reading never
+// lies outside the values actually seen (a constant 100% stays 100)
+static inline float bucket_value(const MetricStats &s, uint8_t idx)
+{
+  int32_t v = s.lo_x10 + (int32_t)idx * s.bucket_x10 + s.bucket_x10 / 2;
+  if (v < s.session_min_x10) v = s.session_min_x10;
+  if (v > s.session_max_x10) v = s.session_max_x10;
+  return v / 10.0f;
+}
+
+void Stats_Init(MetricStats &s, float lo, float bucket_width)
+{
+  memset(&s, 0, sizeof(s));
+  s.lo_x10 = to_x10(lo);
+  s.bucket_x10 = to_x10(bucket_width) > 0 ? to_x10(bucket_width) : 1;
+  s.session_min_x10 = INT16_MAX;
+  s.session_max_x10 = INT16_MIN;
+}
+
+void Stats_Push(MetricStats &s, float value)
+{
+  int16_t v = to_x10(value);
+
+  if (s.count == STATS_WINDOW_S) {
+    int16_t old = s.ring[s.head];
+    s.sum_x10 -= old;
+    s.hist[bucket_of(s, old)]--;
+  } else {
+    s.count++;
+  }
+
+  s.ring[s.head] = v;
+  s.head = (s.head + 1) % STATS_WINDOW_S;
+  s.sum_x10 += v;
+  s.hist[bucket_of(s, v)]++;
+
+  if (v < s.session_min_x10) s.session_min_x10 = v;
+  if (v > s.session_max_x10) s.session_max_x10 = v;
+}
+
+float Stats_Percentile(const MetricStats &s, uint8_t pct)
+{
+  if (s.count == 0) return 0.0f;
+
+  // Rank of the requested percentile (nearest-rank, 1-based)
+  uint32_t rank = ((uint32_t)s.count * pct + 99) / 100;
+  if (rank == 0) rank = 1;
+
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < STATS_BUCKETS; i++) {
+    seen += s.hist[i];
+    if (seen >= rank) return bucket_value(s, i);
+  }
+  return bucket_value(s, STATS_BUCKETS - 1);
+}
+
+void Stats_Summarize(const MetricStats &s, StatsSummary &out)
+{
+  memset(&out, 0, sizeof(out));
+  out.count = s.count;
+  if (s.count == 0) return;
+
+  uint8_t lo = 0, hi = STATS_BUCKETS - 1;
+  while (lo < STATS_BUCKETS - 1 && s.hist[lo] == 0) lo++;
+  while (hi > 0 && s.hist[hi] == 0) hi--;
+
+  out.p50 = Stats_Percentile(s, 50);
+  out.p95 = Stats_Percentile(s, 95);
+  out.min = bucket_value(s, lo);
+  out.max = bucket_value(s, hi);
+  out.avg = (float)s.sum_x10 / s.count / 10.0f;
+  out.session_min = s.session_min_x10 / 10.0f;
+  out.session_max = s.session_max_x10 / 10.0f;
+}
@@ -0,0 +1,396 @@
+#include "Serial_Mux.h"
+#include <stdarg.h>
+
+#ifndef MUX_PORT
+#define MUX_PORT Serial
+#endif
+
+#define MUX_RAW_MAX     (MUX_MAX_PAYLOAD + 4)   // Header, payload, CRC
+#define MUX_ENCODED_MAX (MUX_RAW_MAX + 2)       // COBS adds one byte per 254
+#define MUX_BLOCK_MS    50                      // Longest wait for queue space before dropping
+
+// Byte ring; message channels store <len><payload> records, the bulk channel a plain stream
+struct MuxQueue {
+  uint8_t *buf;
+  uint16_t size;
+  uint16_t head;              // Next write
+  uint16_t tail;              // Next read
+  uint16_t used;
+};
+
+static uint8_t realtime_buf[256];
+static uint8_t control_buf[256];
+static uint8_t log_buf[512];
+static uint8_t bulk_buf[6144];     // Holds a whole black-box dump
+
+static MuxQueue queues[MUX_CHANNELS] = {
+  { realtime_buf, sizeof(realtime_buf), 0, 0, 0 },
+  { control_buf, sizeof(control_buf), 0, 0, 0 },
+  { log_buf, sizeof(log_buf), 0, 0, 0 },
+  { bulk_buf, sizeof(bulk_buf), 0, 0, 0 },
+};
+
+static uint8_t tx_seq[MUX_CHANNELS];
+static bool bulk_fin = false;
+static bool bulk_error = false;    // Bytes of the current transfer were dropped
+static bool bulk_mid_line = false; // Line mode: the last bulk byte sent was not '\n'
+static int tx_capacity = 0;        // Largest free space seen in the port's transmit buffer (= empty)
+
+static uint8_t rx_frame[MUX_ENCODED_MAX];
+static size_t rx_frame_len = 0;
+static bool rx_in_frame = false;
+static char rx_line[MUX_MAX_PAYLOAD + 1];
+static size_t rx_line_len = 0;
+
+static bool framed = false;
+static uint32_t bad_frames = 0;
+static uint32_t dropped = 0;
+
+static inline uint16_t queue_free(const MuxQueue &q) { return q.size - q.used; }
+
+static void queue_put(MuxQueue &q, const uint8_t *data, size_t len)
+{
+  for (size_t i = 0; i < len; i++) {
+    q.buf[q.head] = data[i];
+    q.head = (q.head + 1) % q.size;
+  }
+  q.used += len;
+}
+
+static void queue_peek(const MuxQueue &q, size_t offset, uint8_t *out, size_t len)
+{
+  for (size_t i = 0; i < len; i++) {
+    out[i] = q.buf[(q.tail + offset + i) % q.size];
+  }
+}
+
+static void queue_drop(MuxQueue &q, size_t len)
+{
+  q.tail = (q.tail + len) % q.size;
+  q.used -= len;
+}
+
+static uint16_t crc16(const uint8_t *data, size_t len)
+{
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+static size_t cobs_encode(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t code_pos = 0;
+  size_t pos = 1;
+  uint8_t code = 1;
+  for (size_t i = 0; i < len; i++) {
+    if (in[i] == 0) {
+      out[code_pos] = code;
+      code_pos = pos++;
+      code = 1;
+    } else {
+      out[pos++] = in[i];
+      if (++code == 0xFF) {
+        out[code_pos] = code;
+        code_pos = pos++;
+        code = 1;
+      }
+    }
+  }
+  out[code_pos] = code;
+  return pos;
+}
+
+// Returns the decoded length, 0 for a malformed block
+static size_t cobs_decode(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t i = 0;
+  size_t pos = 0;
+  while (i < len) {
+    uint8_t code = in[i++];
+    if (code == 0 || i + code - 1 > len) {
+      return 0;
+    }
+    for (uint8_t k = 1; k < code; k++) {
+      out[pos++] = in[i++];
+    }
+    if (code != 0xFF && i < len) {
+      out[pos++] = 0;
+    }
+  }
+  return pos;
+}
+
+static size_t frame_size(size_t payload) { return payload + 4 + 1 + 2; }   // + COBS code + delimiters
+
+static void write_frame(MuxChannel channel, uint8_t flags, const uint8_t *payload, size_t len)
+{
+  uint8_t raw[MUX_RAW_MAX];
+  uint8_t out[MUX_ENCODED_MAX + 2];
+
+  raw[0] = (uint8_t)(channel << 4) | flags;
+  raw[1] = tx_seq[channel]++;
+  memcpy(raw + 2, payload, len);
+  uint16_t crc = crc16(raw, len + 2);
+  raw[len + 2] = crc >> 8;
+  raw[len + 3] = crc & 0xFF;
+
+  out[0] = 0;
+  size_t n = cobs_encode(raw, len + 4, out + 1);
+  out[n + 1] = 0;
+  MUX_PORT.write(out, n + 2);
+}
+
+// Wait for room in a queue, sending queued frames meanwhile; false after MUX_BLOCK_MS
+static bool wait_for_room(MuxQueue &q, size_t len)
+{
+  unsigned long start = millis();
+  while (queue_free(q) < len) {
+    if (millis() - start > MUX_BLOCK_MS) {
+      return false;
+    }
+    Mux_Poll();
+    delay(1);
+  }
+  return true;
+}
+
+class MuxBulkWriter : public Print {
+public:
+  size_t write(uint8_t c) override { return write(&c, 1); }
+
+  size_t write(const uint8_t *data, size_t len) override {
+    MuxQueue &q = queues[MUX_BULK];
+    size_t done = 0;
+    while (done < len) {
+      if (!queue_free(q) && !wait_for_room(q, 1)) {
+        dropped++;
+        bulk_error = true;
+        break;
+      }
+      size_t n = min((size_t)queue_free(q), len - done);
+      queue_put(q, data + done, n);
+      done += n;
+    }
+    return done;
+  }
+};
+
+static MuxBulkWriter bulk_writer;
+
+void Mux_Init()
+{
+  tx_capacity = MUX_PORT.availableForWrite();
+}
+
+// Decode the buffered frame into `line`; false (and counted) if it is damaged
+static bool decode_frame(char *line, size_t size, size_t *len, MuxChannel *channel)
+{
+  uint8_t raw[MUX_ENCODED_MAX];
+  size_t n = cobs_decode(rx_frame, rx_frame_len, raw);
+  if (n < 4 || n > MUX_RAW_MAX || crc16(raw, n - 2) != ((raw[n - 2] << 8) | raw[n - 1]) ||
+      (raw[0] >> 4) >= MUX_CHANNELS || n - 4 >= size) {
+    bad_frames++;
+    return false;
+  }
+  *channel = (MuxChannel)(raw[0] >> 4);
+  *len = n - 4;
+  memcpy(line, raw + 2, *len);
+  line[*len] = '\0';
+  return true;
+}
+
+static bool printable(const char *text, size_t len)
+{
+  for (size_t i = 0; i < len; i++) {
+    if (text[i] < 0x20 || text[i] > 0x7E) {
+      return false;
+    }
+  }
+  return true;
+}
+
+MuxResult Mux_Receive(char *line, size_t size, size_t *len, MuxChannel *channel)
+{
+  while (MUX_PORT.available() > 0) {
+    uint8_t c = MUX_PORT.read();
+
+    if (c == 0x00) {
+      // A delimiter closes a non-empty frame; otherwise it opens one (repeated delimiters resync)
+      if (rx_in_frame && rx_frame_len > 0) {
+        rx_in_frame = false;
+        if (decode_frame(line, size, len, channel)) {
+          framed = true;
+          return MUX_LINE;
+        }
+        continue;
+      }
+      rx_in_frame = true;
+      rx_frame_len = 0;
+      rx_line_len = 0;
+      continue;
+    }
+
+    if (rx_in_frame) {
+      if (rx_frame_len < sizeof(rx_frame)) {
+        rx_frame[rx_frame_len++] = c;
+      } else {
+        bad_frames++;
+        rx_in_frame = false;
+      }
+      continue;
+    }
+
+    // Legacy newline-terminated line
+    if (c == '\n' || c == '\r') {
+      if (rx_line_len == 0) {
+        continue;
+      }
+      *len = min(rx_line_len, size - 1);
+      memcpy(line, rx_line, *len);
+      line[*len] = '\0';
+      *channel = MUX_REALTIME;
+      rx_line_len = 0;
+      // Only clean text counts as a legacy host; bytes of a frame whose start was lost do not
+      if (printable(line, *len)) {
+        framed = false;
+      }
+      return MUX_LINE;
+    }
+    if (rx_line_len < sizeof(rx_line) - 1 && rx_line_len < size - 1) {
+      rx_line[rx_line_len++] = (char)c;
+    } else {
+      *len = min(rx_line_len, size - 1);
+      memcpy(line, rx_line, *len);
+      line[*len] = '\0';
+      rx_line_len = 0;
+      return MUX_OVERFLOW;
+    }
+  }
+  return MUX_NONE;
+}
+
+void Mux_Send(MuxChannel channel, const char *text, size_t len)
+{
+  if (channel == MUX_BULK) {
+    bulk_writer.write((const uint8_t *)text, len);
+    return;
+  }
+  if (len > MUX_MAX_PAYLOAD) {
+    len = MUX_MAX_PAYLOAD;
+  }
+
+  MuxQueue &q = queues[channel];
+  if (queue_free(q) < len + 1) {
+    // Logs are best effort; replies and live data wait briefly for the link to drain
+    if (channel == MUX_LOG || !wait_for_room(q, len + 1)) {
+      dropped++;
+      return;
+    }
+  }
+  uint8_t header = (uint8_t)len;
+  queue_put(q, &header, 1);
+  queue_put(q, (const uint8_t *)text, len);
+}
+
+void Mux_Print(MuxChannel channel, const char *text)
+{
+  Mux_Send(channel, text, strlen(text));
+}
+
+void Mux_Printf(MuxChannel channel, const char *format, ...)
+{
+  char text[MUX_MAX_PAYLOAD + 1];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  if (len < 0) {
+    return;
+  }
+  size_t n = min((size_t)len, sizeof(text) - 1);
+  while (n && text[n - 1] == '\n') {
+    n--;
+  }
+  Mux_Send(channel, text, n);
+}
+
+Print &Mux_Bulk()
+{
+  return bulk_writer;
+}
+
+void Mux_EndBulk()
+{
+  bulk_fin = true;
+}
+
+void Mux_Poll()
+{
+  uint8_t payload[MUX_MAX_PAYLOAD];
+  int available = MUX_PORT.availableForWrite();
+  if (available > tx_capacity) {
+    tx_capacity = available;
+  }
+
+  // Whole messages, highest priority first; in line mode not inside a dump line
+  for (uint8_t ch = MUX_REALTIME; ch < MUX_BULK && !(bulk_mid_line && !framed); ch++) {
+    MuxQueue &q = queues[ch];
+    while (q.used) {
+      uint8_t len;
+      queue_peek(q, 0, &len, 1);
+      if (MUX_PORT.availableForWrite() < (int)frame_size(len)) {
+        return;   // Transmit buffer full; keep the order and retry next loop
+      }
+      queue_peek(q, 1, payload, len);
+      queue_drop(q, len + 1);
+      if (framed) {
+        write_frame((MuxChannel)ch, 0, payload, len);
+      } else {
+        MUX_PORT.write(payload, len);
+        MUX_PORT.write('\n');
+      }
+    }
+  }
+
+  // One bulk chunk, and only into an empty transmit buffer, so a message queued
+  // from now on waits behind at most this chunk
+  MuxQueue &bulk = queues[MUX_BULK];
+  if ((!bulk.used && !bulk_fin) || MUX_PORT.availableForWrite() < tx_capacity) {
+    return;
+  }
+  size_t n = min((size_t)bulk.used, (size_t)MUX_BULK_CHUNK);
+  bool fin = bulk_fin && n == bulk.used;
+  queue_peek(bulk, 0, payload, n);
+  queue_drop(bulk, n);
+  if (framed) {
+    write_frame(MUX_BULK, fin ? MUX_FLAG_FIN | (bulk_error ? MUX_FLAG_ERROR : 0) : 0, payload, n);
+  } else if (n) {
+    MUX_PORT.write(payload, n);
+    bulk_mid_line = payload[n - 1] != '\n';
+  }
+  if (fin) {
+    bulk_fin = false;
+    bulk_error = false;
+    bulk_mid_line = false;
+  }
+}
+
+bool Mux_Framed()
+{
+  return framed;
+}
+
+uint32_t Mux_BadFrames()
+{
+  return bad_frames;
+}
+
+uint32_t Mux_Dropped()
+{
+  return dropped;
+}
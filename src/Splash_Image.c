@@ -0,0 +1,237 @@
+// Generated by scripts/make_splash.py from assets/splash.png; do not edit.
+// 172x320 panel-native RGB565, 3652 bytes (raw 110080)
+#include "Splash_Image.h"
+
+const uint8_t splash_image[] = {
+  0x53, 0x35, 0x36, 0x35, 0xAC, 0x00, 0x40, 0x01, 0x00, 0x00, 0xA8, 0x1B, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0x1A, 0x40, 0x80, 0x44, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x1A, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71, 0x02,
+  0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71,
+  0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12,
+  0x71, 0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x12, 0x71, 0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x12, 0x71, 0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x12, 0x71, 0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x12, 0x71, 0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x12, 0x71, 0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x16, 0x71, 0x06, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x16, 0x71, 0x06, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x16,
+  0x71, 0x06, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x16, 0x71, 0x06, 0x40,
+  0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12,
+  0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x80, 0x48,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80,
+  0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40,
+  0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02,
+  0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71,
+  0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12,
+  0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40,
+  0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80,
+  0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x04, 0xFF, 0x1A, 0x90, 0x80, 0x04, 0x40, 0x1C,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x04, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x04, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x80, 0x04, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x80, 0x04, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80,
+  0x04, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40,
+  0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40,
+  0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C, 0x03, 0x40,
+  0x02, 0xFF, 0xE0, 0x07, 0x12, 0x40, 0x22, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71, 0x06, 0x40, 0x28, 0x6C,
+  0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x12, 0x71, 0x06, 0x40, 0x28, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71, 0x06, 0x40, 0x28, 0x6C,
+  0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x12, 0x71, 0x06, 0x40, 0x28, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C,
+  0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C,
+  0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x1A, 0x71, 0x02, 0x40, 0x24, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x12, 0x40, 0x22, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C,
+  0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71,
+  0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C,
+  0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x35, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B,
+  0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x15, 0x6C, 0x03, 0x40, 0x08, 0x6C,
+  0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x15, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B,
+  0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71,
+  0x12, 0x40, 0x15, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x15, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x24, 0x40, 0x10, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C,
+  0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C,
+  0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71,
+  0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71,
+  0x02, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x15, 0x6C, 0x12, 0x40, 0x3A, 0x6C,
+  0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x15, 0x6C,
+  0x12, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71,
+  0x12, 0x40, 0x15, 0x6C, 0x12, 0x40, 0x02, 0xFF, 0x00, 0xFB, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x15, 0x6C, 0x12, 0x40,
+  0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x35, 0x6C, 0x12, 0x40, 0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C, 0x12, 0x40, 0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C, 0x12, 0x40, 0x02, 0x55, 0x1A, 0x40,
+  0x1A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C, 0x12, 0x40,
+  0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x12, 0x40, 0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x12, 0x40,
+  0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x12, 0x40, 0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x12, 0x40,
+  0x02, 0x55, 0x1A, 0x40, 0x1A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x16, 0x71, 0x06, 0x40, 0x15, 0x6C, 0x12, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x16, 0x71, 0x06, 0x40, 0x15, 0x6C, 0x12, 0x40, 0x3A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x16, 0x71, 0x06, 0x40, 0x15, 0x6C, 0x12, 0x40,
+  0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x16, 0x71, 0x06, 0x40,
+  0x15, 0x6C, 0x12, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x0E, 0x71, 0x06, 0x40, 0x1D, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0E, 0x71, 0x06, 0x40, 0x1D, 0x6C, 0x03, 0x40,
+  0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x0E, 0x71, 0x06, 0x40, 0x1D, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x2C, 0x40,
+  0x08, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0E, 0x71, 0x06, 0x40,
+  0x1D, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x03, 0x40,
+  0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x2C, 0x40,
+  0x08, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40,
+  0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x35, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x35, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x35, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x2C, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40,
+  0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C, 0x03, 0x40,
+  0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40,
+  0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40,
+  0x12, 0x71, 0x02, 0x40, 0x11, 0x6C, 0x03, 0x40, 0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x11, 0x6C, 0x03, 0x40,
+  0x08, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40,
+  0x28, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40,
+  0x20, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40, 0x28, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40,
+  0x02, 0x7B, 0x0C, 0x40, 0x28, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40,
+  0x28, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40,
+  0x12, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40, 0x28, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40,
+  0x20, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40, 0x28, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x80, 0x04, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40, 0x28, 0x6C, 0x03,
+  0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x04, 0x6C, 0x03, 0x40, 0x02, 0x7B,
+  0x0C, 0x40, 0x28, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x04,
+  0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40, 0x28, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x80, 0x04, 0x6C, 0x03, 0x40, 0x02, 0x7B, 0x0C, 0x40, 0x28, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40,
+  0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40,
+  0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x1E, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40,
+  0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40,
+  0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x1E, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x03, 0x40, 0x3A, 0x6C, 0x03, 0x40,
+  0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x20, 0x6C, 0x03, 0x40,
+  0x3A, 0x6C, 0x03, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40,
+  0x20, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A,
+  0x40, 0x20, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71,
+  0x1A, 0x40, 0x20, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E,
+  0x71, 0x02, 0x40, 0x20, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x1E, 0x71, 0x02, 0x40, 0x20, 0x6C, 0x80, 0x04, 0x40, 0x1C, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x1E, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71,
+  0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x80,
+  0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x1E, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80,
+  0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x0A, 0x71, 0x12, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12,
+  0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x80, 0x48,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80,
+  0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02, 0x40,
+  0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71, 0x02,
+  0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12, 0x71,
+  0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40, 0x12,
+  0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02, 0x40,
+  0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x02,
+  0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71,
+  0x02, 0x40, 0x12, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A,
+  0x71, 0x12, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40,
+  0x80, 0x48, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x80, 0x48, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0A, 0x71, 0x12, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x1A, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x06, 0x71, 0x1A, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71,
+  0x1A, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71, 0x02, 0x40, 0x06,
+  0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71, 0x02, 0x40,
+  0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71, 0x02,
+  0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x12, 0x71,
+  0x02, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x0E,
+  0x71, 0x06, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x0E, 0x71, 0x06, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00,
+  0x00, 0x0E, 0x71, 0x06, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0x0E, 0x71, 0x06, 0x40, 0x06, 0x71, 0x02, 0x40, 0x80, 0x44, 0xFF, 0x10, 0x84, 0x00,
+  0xFF, 0x00, 0x00, 0x06, 0x71, 0x06, 0x40, 0x06, 0x71, 0x06, 0x40, 0x80, 0x48, 0xFF, 0x10, 0x84,
+  0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x06, 0x40, 0x06, 0x71, 0x06, 0x40, 0x80, 0x48, 0xFF, 0x10,
+  0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x06, 0x40, 0x06, 0x71, 0x06, 0x40, 0x80, 0x48, 0xFF,
+  0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x06, 0x71, 0x06, 0x40, 0x06, 0x71, 0x06, 0x40, 0x80, 0x48,
+  0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00,
+  0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x68, 0xFF, 0x10, 0x84, 0x00, 0xFF,
+  0x00, 0x00, 0xA8, 0xAC,
+};
+
+const uint32_t splash_image_len = sizeof(splash_image);
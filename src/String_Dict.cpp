@@ -0,0 +1,70 @@
+#include "String_Dict.h"
+
+static StringDictEntry *find_entry(StringDict &d, uint8_t id)
+{
+  for (uint8_t i = 0; i < STRDICT_SLOTS; i++) {
+    if (d.entries[i].id == id) return &d.entries[i];
+  }
+  return NULL;
+}
+
+// Ages are taken relative to the clock, so the 16-bit counter may wrap
+static inline void touch(StringDict &d, StringDictEntry &e)
+{
+  e.last_use = ++d.clock;
+}
+
+void StrDict_Init(StringDict &d)
+{
+  memset(&d, 0, sizeof(d));
+}
+
+uint8_t StrDict_Define(StringDict &d, uint8_t id, const char *text, size_t len)
+{
+  uint8_t evicted = STRDICT_NONE;
+
+  if (id == STRDICT_NONE) {
+    return STRDICT_NONE;
+  }
+
+  StringDictEntry *e = find_entry(d, id);
+  if (!e) {
+    e = find_entry(d, STRDICT_NONE);
+  }
+  if (!e) {
+    // Full: evict the least recently used entry
+    e = &d.entries[0];
+    for (uint8_t i = 1; i < STRDICT_SLOTS; i++) {
+      if ((uint16_t)(d.clock - d.entries[i].last_use) > (uint16_t)(d.clock - e->last_use)) {
+        e = &d.entries[i];
+      }
+    }
+    evicted = e->id;
+  }
+
+  if (len > STRDICT_MAX_LEN) len = STRDICT_MAX_LEN;
+  memcpy(e->text, text, len);
+  e->text[len] = '\0';
+  e->id = id;
+  if (++d.generation == 0) d.generation = 1;
+  e->version = d.generation;
+  touch(d, *e);
+  return evicted;
+}
+
+const char *StrDict_Lookup(StringDict &d, uint8_t id)
+{
+  StringDictEntry *e = id == STRDICT_NONE ? NULL : find_entry(d, id);
+  if (!e) return NULL;
+  touch(d, *e);
+  return e->text;
+}
+
+uint8_t StrDict_Version(const StringDict &d, uint8_t id)
+{
+  if (id == STRDICT_NONE) return 0;
+  for (uint8_t i = 0; i < STRDICT_SLOTS; i++) {
+    if (d.entries[i].id == id) return d.entries[i].version;
+  }
+  return 0;
+}
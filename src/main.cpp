@@ -1,13 +1,20 @@
 #include "Display_ST7789.h"
 #include "LVGL_Driver.h"
 #include "ui_hardware_monitor.h"
+#include "ui_metric_row.h"
+#include "Metric_Stats.h"
+#include "Metric_History.h"
+#include "String_Dict.h"
+#include "Frame_Recorder.h"
+#include "Serial_Mux.h"
 #include <esp_pm.h>
 #include <esp_sleep.h>
+#include <esp_system.h>
 
 // Serial communication settings
 #define SERIAL_BAUDRATE 115200
-#define SERIAL_BUFFER_SIZE 128
-#define DATA_TIMEOUT_MS 5000  // 5 seconds without data = disconnected
+#define SERIAL_BUFFER_SIZE (MUX_MAX_PAYLOAD + 1)
+#define DATA_TIMEOUT_MS 5000  // 5 seconds without data = disconnected (host keepalive must stay below this)
 
 // Power saving settings
 #define POWER_SAVE_BACKLIGHT 0    // Backlight level when disconnected (0 = off)
@@ -15,6 +22,29 @@
 #define POWER_SAVE_DELAY_MS 10000  // 10 seconds after disconnect before power saving
 #define ENABLE_CPU_FREQ_SCALING true  // Enable CPU frequency reduction
 
+// Page button (BOOT button on the ESP32-C6 devkit)
+// Short press: next page, long press: toggle dashboard/stats
+#define BUTTON_PIN 9
+#define BUTTON_DEBOUNCE_MS 30
+#define BUTTON_LONG_PRESS_MS 700
+
+// THR: extension field (flag bits match THROTTLE_* in pc_monitor.py)
+#define THROTTLE_VALUES 3
+#define THROTTLE_CAPPED 1    // Policy frequency cap below the hardware maximum
+#define THROTTLE_THERMAL 2   // Thermal throttle events since the previous sample
+
+// TCP: extension field: retransmits (tenths of a percent), active/passive opens/s, listen drops/s
+#define TCP_VALUES 4
+#define TCP_RETRANS_WARN 20  // 2.0% of segments sent retransmitted turns the network row magenta
+
+// IRQ: extension field (flag bits match pc_monitor_irq.py)
+#define IRQ_VALUES 3
+#define IRQ_STORM_HARD 1     // A hardware interrupt line far above its baseline on some CPU
+#define IRQ_STORM_SOFT 2     // Same for a softirq
+
+// FS: extension field: used percent of the fullest filesystem, alert flag (--fs-alert-pct on the host)
+#define FS_VALUES 2
+
 // System metrics structure
 struct SystemMetrics {
   // Required fields
@@ -52,50 +82,144 @@ SystemMetrics metrics = {
   false, 0                 // power_save_mode, disconnect_time
 };
 
+// Extension fields from EXT: lines. Each field has its own timestamp and
+// reads as absent once it is older than DATA_TIMEOUT_MS.
+struct CustomMetric {
+  uint8_t name_id;          // String dictionary ID, STRDICT_NONE for an empty slot
+  float value;
+  unsigned long seen;
+};
+
+struct ExtFields {
+  uint8_t host_id;          // String dictionary IDs
+  unsigned long host_seen;
+  uint8_t ifname_id;
+  unsigned long ifname_seen;
+  CustomMetric custom[UI_CUSTOM_ROWS];   // Host-pushed metrics, M0..M5
+  uint16_t cpu_times[UI_CPU_TIME_COUNT]; // Tenths of a percent, ui_cpu_time_t order
+  unsigned long cpu_times_seen;
+  uint32_t memory[UI_MEM_COUNT];         // Memory detail, ui_memory_field_t order
+  unsigned long memory_seen;
+  uint32_t throttle[THROTTLE_VALUES];    // Flags, percent of max frequency capped, current percent of max
+  unsigned long throttle_seen;
+  uint32_t tcp[TCP_VALUES];              // Retransmit tenths of %, opens/s, passive opens/s, listen drops/s
+  unsigned long tcp_seen;
+  uint8_t numa[UI_NUMA_NODES * 2];       // CPU % and memory used % per node
+  uint8_t numa_nodes;
+  unsigned long numa_seen;
+  uint32_t irq[IRQ_VALUES];              // Storm flags, interrupts/s, softirqs/s
+  unsigned long irq_seen;
+  uint8_t irq_source_id;                 // String ID of the storming IRQ or softirq
+  unsigned long irq_source_seen;
+  uint32_t fs[FS_VALUES];                // Fullest filesystem used %, alert flag
+  unsigned long fs_seen;
+  uint8_t fs_mount_id;                   // String ID of its mount point
+  unsigned long fs_mount_seen;
+  uint16_t cstates[UI_CSTATE_SLOTS];     // Tenths of a percent: active, then each idle state
+  uint8_t cstate_count;
+  unsigned long cstates_seen;
+  uint8_t cstate_names[UI_CSTATE_SLOTS]; // String IDs of the idle state names, CS0 in slot 1
+  unsigned long cstate_names_seen;
+};
+
+ExtFields ext = { STRDICT_NONE, 0, STRDICT_NONE, 0, {}, {}, 0, {}, 0, {}, 0, {}, 0, {}, 0, 0, {}, 0, STRDICT_NONE, 0,
+                  {}, 0, STRDICT_NONE, 0, {}, 0, 0, {}, 0 };
+
+// Host-defined strings referenced by ID from EXT: lines
+StringDict strings;
+
+// Windowed statistics (metricStats in Metric_Stats.cpp), indexed by ui_stats_row_t
+static_assert(UI_STATS_COUNT == STATS_METRICS, "one MetricStats per stats page row");
+
+// Tiered history for the history page (cpuHistory/tempHistory in Metric_History.cpp)
+static_assert(HISTORY_NO_DATA == UI_HISTORY_GAP, "history gap marker must match the UI");
+unsigned long historyTicks = 0;
+
+static_assert(SERIAL_BUFFER_SIZE <= RECORDER_FRAME_LEN, "recorder slots must hold a full line");
+
 // Serial buffer for incoming data
 char serialBuffer[SERIAL_BUFFER_SIZE];
-int bufferIndex = 0;
 
 // Function prototypes
 void initSerial();
 void processSerialData();
-bool parseMessage(const char* message);
+FrameResult parseMessage(const char* message);
+FrameResult parseDefinition(const char* message);
+FrameResult parseExtension(const char* message);
+const char* findField(const char* message, const char* key);
+uint8_t parseStringRef(const char* value);
+int parsePacked(const char* value, uint32_t* out, int count);
 void updateDisplay();
 bool validateChecksum(const char* message);
 void checkConnectionStatus();
 void enterPowerSaveMode();
 void exitPowerSaveMode();
 void managePowerSaving();
+void initStats();
+void metricsTick();
+void handleButton();
+void updateLabels();
+void updateCustom();
+void updateMemory();
+void updateNuma();
+void updateCStates();
+void updateAlert();
+#ifdef UI_PROFILE
+void profileUi();
+#endif
 
 void setup() {
   // Initialize Serial first for debugging
   initSerial();
 
+  // Keep the black-box ring across soft resets
+  Recorder_Init(esp_reset_reason() == ESP_RST_POWERON);
+
   // Initialize display
   LCD_Init();
   Lvgl_Init();
   ui_hardware_monitor_init();
   Set_Backlight(NORMAL_BACKLIGHT);
 
-  Serial.println("Hardware Monitor Started");
-  Serial.println("Waiting for data from PC...");
+  initStats();
+  StrDict_Init(strings);
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+
+#ifdef UI_PROFILE
+  profileUi();
+#endif
+
+  Mux_Print(MUX_LOG, "Hardware Monitor Started");
+  Mux_Print(MUX_LOG, "Waiting for data from PC...");
 }
 
 void loop() {
   // Process incoming serial data
   processSerialData();
+
+  // Send queued replies, logs and dump chunks by channel priority
+  Mux_Poll();
   
   // Check connection status
   checkConnectionStatus();
   
   // Manage power saving mode
   managePowerSaving();
+
+  // Feed windowed statistics and history
+  metricsTick();
+
+  // Page navigation
+  handleButton();
   
   // Update display
   updateDisplay();
   
   // Handle LVGL tasks
   Timer_Loop();
+
+  // Panel refresh rate: lower while static or in power save
+  Lvgl_Adapt_Frame_Rate(metrics.power_save_mode);
   
   // Longer delay in power save mode to reduce CPU usage
   delay(metrics.power_save_mode ? 100 : 5);
@@ -105,49 +229,69 @@ void initSerial() {
   Serial.begin(SERIAL_BAUDRATE);
   // Wait for serial to be ready (important for ESP32-C6 USB CDC)
   delay(100);
+  Mux_Init();
 }
 
 void processSerialData() {
-  while (Serial.available() > 0) {
-    char c = Serial.read();
-    
-    // Check for newline (end of message)
-    if (c == '\n' || c == '\r') {
-      if (bufferIndex > 0) {
-        serialBuffer[bufferIndex] = '\0';  // Null terminate
-        
-        // Parse the message
-        if (parseMessage(serialBuffer)) {
-          metrics.last_update = millis();
-          
-          // If reconnecting, exit power save mode
-          if (!metrics.connected) {
-            Serial.println("Connection restored");
-          }
-          
-          metrics.connected = true;
-        }
-        
-        // Reset buffer
-        bufferIndex = 0;
-      }
-    } else if (bufferIndex < SERIAL_BUFFER_SIZE - 1) {
-      serialBuffer[bufferIndex++] = c;
+  size_t len;
+  MuxChannel channel;
+  MuxResult received;
+  while ((received = Mux_Receive(serialBuffer, SERIAL_BUFFER_SIZE, &len, &channel)) != MUX_NONE) {
+    if (received == MUX_OVERFLOW) {
+      // Buffer overflow: record the truncated line, then drop it
+      Recorder_Push(serialBuffer, len, FRAME_OVERFLOW);
+      Mux_Print(MUX_LOG, "Error: Buffer overflow");
+      continue;
+    }
+
+    // Commands from the host are not recorded
+    if (strcmp(serialBuffer, "DUMP") == 0) {
+      Recorder_Dump(Mux_Bulk());
+      Mux_EndBulk();
+      continue;
+    }
+    if (strcmp(serialBuffer, "HELLO") == 0) {
+      Mux_Printf(MUX_CONTROL, "HELLO:%d", MUX_VERSION);
+      continue;
+    }
+    // Only metric lines are parsed and recorded
+    if (channel != MUX_REALTIME) {
+      continue;
+    }
+
+    // Dictionary and extension lines carry no base metrics
+    FrameResult result;
+    bool base = false;
+    if (strncmp(serialBuffer, "STR:", 4) == 0) {
+      result = parseDefinition(serialBuffer);
+    } else if (strncmp(serialBuffer, "EXT:", 4) == 0) {
+      result = parseExtension(serialBuffer);
     } else {
-      // Buffer overflow, reset
-      bufferIndex = 0;
-      Serial.println("Error: Buffer overflow");
+      result = parseMessage(serialBuffer);
+      base = true;
+    }
+    Recorder_Push(serialBuffer, len, result);
+
+    if (base && result == FRAME_OK) {
+      metrics.last_update = millis();
+
+      // If reconnecting, exit power save mode
+      if (!metrics.connected) {
+        Mux_Print(MUX_LOG, "Connection restored");
+      }
+
+      metrics.connected = true;
     }
   }
 }
 
-bool parseMessage(const char* message) {
+FrameResult parseMessage(const char* message) {
   // Expected format: CPU:45.2,RAM:67.8,TEMP:58.5[,FREQ:3.8][,RAMGB:11.9/31.3][,FAN:1500][,NET:125,15][,BAT:85][,POWER:10.0],CHK:XXX
 
   // First validate checksum
   if (!validateChecksum(message)) {
-    Serial.println("Error: Invalid checksum");
-    return false;
+    Mux_Print(MUX_LOG, "Error: Invalid checksum");
+    return FRAME_BAD_CHECKSUM;
   }
 
   // Reset optional fields to default values
@@ -169,8 +313,8 @@ bool parseMessage(const char* message) {
   if (pos) {
     metrics.cpu_usage = atof(pos + 4);
   } else {
-    Serial.println("Error: CPU field missing");
-    return false;
+    Mux_Print(MUX_LOG, "Error: CPU field missing");
+    return FRAME_MISSING_FIELD;
   }
 
   // RAM (required)
@@ -178,8 +322,8 @@ bool parseMessage(const char* message) {
   if (pos) {
     metrics.ram_usage = atof(pos + 4);
   } else {
-    Serial.println("Error: RAM field missing");
-    return false;
+    Mux_Print(MUX_LOG, "Error: RAM field missing");
+    return FRAME_MISSING_FIELD;
   }
 
   // TEMP (required)
@@ -187,8 +331,8 @@ bool parseMessage(const char* message) {
   if (pos) {
     metrics.temperature = atof(pos + 5);
   } else {
-    Serial.println("Error: TEMP field missing");
-    return false;
+    Mux_Print(MUX_LOG, "Error: TEMP field missing");
+    return FRAME_MISSING_FIELD;
   }
 
   // Parse optional fields
@@ -239,11 +383,254 @@ bool parseMessage(const char* message) {
   if (metrics.cpu_usage < 0.0 || metrics.cpu_usage > 100.0 ||
       metrics.ram_usage < 0.0 || metrics.ram_usage > 100.0 ||
       metrics.temperature < 0.0 || metrics.temperature > 150.0) {
-    Serial.println("Error: Values out of range");
-    return false;
+    Mux_Print(MUX_LOG, "Error: Values out of range");
+    return FRAME_OUT_OF_RANGE;
+  }
+
+  return FRAME_OK;
+}
+
+// Find "KEY:" at the start of a field (line start or after a comma) and
+// return its value, so short keys never match inside longer ones
+const char* findField(const char* message, const char* key) {
+  size_t keyLen = strlen(key);
+  for (const char* pos = strstr(message, key); pos; pos = strstr(pos + 1, key)) {
+    if ((pos == message || pos[-1] == ',') && pos[keyLen] == ':') {
+      return pos + keyLen + 1;
+    }
+  }
+  return NULL;
+}
+
+FrameResult parseDefinition(const char* message) {
+  // Format: STR:<id>=<text>,CHK:XXX (text never contains commas)
+  const char* text = strchr(message, '=');
+  const char* end = strstr(message, ",CHK:");
+  int id = atoi(message + 4);
+  if (!text || !end || end < text || id <= STRDICT_NONE || id > 255) {
+    Mux_Print(MUX_LOG, "Error: Invalid string definition");
+    return FRAME_BAD_DEFINITION;
+  }
+
+  text++;
+  uint8_t evicted = StrDict_Define(strings, (uint8_t)id, text, end - text);
+  if (evicted != STRDICT_NONE) {
+    Mux_Printf(MUX_CONTROL, "EVICT:%u", evicted);
+  }
+  return FRAME_OK;
+}
+
+// Resolve a string reference; unknown IDs are reported as evicted so the host redefines them
+uint8_t parseStringRef(const char* value) {
+  int id = atoi(value);
+  if (id <= STRDICT_NONE || id > 255) {
+    return STRDICT_NONE;
+  }
+  if (!StrDict_Lookup(strings, (uint8_t)id)) {
+    Mux_Printf(MUX_CONTROL, "EVICT:%d", id);
   }
+  return (uint8_t)id;
+}
 
-  return true;
+// Slash-separated unsigned integers ("12/0/345"); returns how many were read, at most `count`
+int parsePacked(const char* value, uint32_t* out, int count) {
+  int n = 0;
+  while (n < count && *value >= '0' && *value <= '9') {
+    out[n++] = strtoul(value, (char**)&value, 10);
+    if (*value != '/') {
+      break;
+    }
+    value++;
+  }
+  return n;
+}
+
+FrameResult parseExtension(const char* message) {
+  // Format: EXT:[HOST:<id>][,IFN:<id>][,CPUT:<u>/<n>/<s>/<irq>/<io>/<st>]
+  //         [,THR:<flags>/<capped %>/<freq %>][,TCP:<retrans>/<active>/<passive>/<drops>]
+  //         [,NUMA:<cpu %>/<mem %> per node][,IRQ:<storm flags>/<irq/s>/<softirq/s>][,IRQN:<id>]
+  //         [,FS:<used %>/<alert>][,FSN:<id>][,CST:<active>/<state 0>/...][,CS<n>:<id>]
+  //         [,MEMX:<swap used>/<swap total>/<cache>/<dirty>/<swap in>/<swap out>/<majflt>]
+  //         [,M<n>:<id>/<value>],CHK:XXX
+  const char* fields = message + 4;
+  const char* pos;
+  unsigned long now = millis();
+
+  if (!validateChecksum(message)) {
+    Mux_Print(MUX_LOG, "Error: Invalid checksum");
+    return FRAME_BAD_CHECKSUM;
+  }
+
+  // Hostname (string ID)
+  pos = findField(fields, "HOST");
+  if (pos) {
+    ext.host_id = parseStringRef(pos);
+    ext.host_seen = now;
+  }
+
+  // Network interface name (string ID)
+  pos = findField(fields, "IFN");
+  if (pos) {
+    ext.ifname_id = parseStringRef(pos);
+    ext.ifname_seen = now;
+  }
+
+  // CPU time breakdown: every category must be present and the sum within 100%
+  pos = findField(fields, "CPUT");
+  if (pos) {
+    uint32_t times[UI_CPU_TIME_COUNT];
+    uint32_t sum = 0;
+    int count = parsePacked(pos, times, UI_CPU_TIME_COUNT);
+    for (int i = 0; i < count; i++) {
+      sum += times[i];
+    }
+    if (count != UI_CPU_TIME_COUNT || sum > 1005) {   // Per-category rounding may overshoot slightly
+      Mux_Print(MUX_LOG, "Error: Invalid CPU time breakdown");
+      return FRAME_OUT_OF_RANGE;
+    }
+    for (int i = 0; i < UI_CPU_TIME_COUNT; i++) {
+      ext.cpu_times[i] = (uint16_t)times[i];
+    }
+    ext.cpu_times_seen = now;
+  }
+
+  // CPU throttling: flag bits and percentages of the hardware maximum frequency
+  pos = findField(fields, "THR");
+  if (pos) {
+    uint32_t throttle[THROTTLE_VALUES];
+    if (parsePacked(pos, throttle, THROTTLE_VALUES) != THROTTLE_VALUES ||
+        throttle[0] > (THROTTLE_CAPPED | THROTTLE_THERMAL) || throttle[1] > 100 || throttle[2] > 200) {
+      Mux_Print(MUX_LOG, "Error: Invalid throttle state");
+      return FRAME_OUT_OF_RANGE;
+    }
+    memcpy(ext.throttle, throttle, sizeof(throttle));
+    ext.throttle_seen = now;
+  }
+
+  // Per-node CPU and memory, two values per node
+  pos = findField(fields, "NUMA");
+  if (pos) {
+    uint32_t numa[UI_NUMA_NODES * 2];
+    int count = parsePacked(pos, numa, UI_NUMA_NODES * 2);
+    bool valid = count >= 4 && count % 2 == 0;
+    for (int i = 0; valid && i < count; i++) {
+      valid = numa[i] <= 100;
+    }
+    if (!valid) {
+      Mux_Print(MUX_LOG, "Error: Invalid NUMA summary");
+      return FRAME_OUT_OF_RANGE;
+    }
+    for (int i = 0; i < count; i++) {
+      ext.numa[i] = (uint8_t)numa[i];
+    }
+    ext.numa_nodes = count / 2;
+    ext.numa_seen = now;
+  }
+
+  // TCP health
+  pos = findField(fields, "TCP");
+  if (pos) {
+    uint32_t tcp[TCP_VALUES];
+    if (parsePacked(pos, tcp, TCP_VALUES) != TCP_VALUES || tcp[0] > 1000) {
+      Mux_Print(MUX_LOG, "Error: Invalid TCP health");
+      return FRAME_OUT_OF_RANGE;
+    }
+    memcpy(ext.tcp, tcp, sizeof(tcp));
+    ext.tcp_seen = now;
+  }
+
+  // Interrupt activity; IRQN names the storm source and is only sent during a storm
+  pos = findField(fields, "IRQ");
+  if (pos) {
+    uint32_t irq[IRQ_VALUES];
+    if (parsePacked(pos, irq, IRQ_VALUES) != IRQ_VALUES || irq[0] > (IRQ_STORM_HARD | IRQ_STORM_SOFT)) {
+      Mux_Print(MUX_LOG, "Error: Invalid interrupt activity");
+      return FRAME_OUT_OF_RANGE;
+    }
+    memcpy(ext.irq, irq, sizeof(irq));
+    ext.irq_seen = now;
+  }
+  pos = findField(fields, "IRQN");
+  if (pos) {
+    ext.irq_source_id = parseStringRef(pos);
+    ext.irq_source_seen = now;
+  }
+
+  // Idle-state residency in tenths of a percent, active first; CS<n> names state n
+  pos = findField(fields, "CST");
+  if (pos) {
+    uint32_t cstates[UI_CSTATE_SLOTS];
+    int count = parsePacked(pos, cstates, UI_CSTATE_SLOTS);
+    uint32_t total = 0;
+    for (int i = 0; i < count; i++) {
+      total += cstates[i];
+    }
+    // Each value is rounded on the host, so the total may overshoot by half a tenth per state
+    if (count < 2 || total > 1000 + (uint32_t)count) {
+      Mux_Print(MUX_LOG, "Error: Invalid C-state residency");
+      return FRAME_OUT_OF_RANGE;
+    }
+    for (int i = 0; i < count; i++) {
+      ext.cstates[i] = (uint16_t)cstates[i];
+    }
+    ext.cstate_count = count;
+    ext.cstates_seen = now;
+  }
+  for (int state = 0; state + 1 < UI_CSTATE_SLOTS; state++) {
+    char key[4] = { 'C', 'S', (char)('0' + state), '\0' };
+    pos = findField(fields, key);
+    if (pos) {
+      ext.cstate_names[state + 1] = parseStringRef(pos);
+      ext.cstate_names_seen = now;
+    }
+  }
+
+  // Fullest filesystem; FSN names its mount point
+  pos = findField(fields, "FS");
+  if (pos) {
+    uint32_t fs[FS_VALUES];
+    if (parsePacked(pos, fs, FS_VALUES) != FS_VALUES || fs[0] > 100 || fs[1] > 1) {
+      Mux_Print(MUX_LOG, "Error: Invalid filesystem usage");
+      return FRAME_OUT_OF_RANGE;
+    }
+    memcpy(ext.fs, fs, sizeof(fs));
+    ext.fs_seen = now;
+  }
+  pos = findField(fields, "FSN");
+  if (pos) {
+    ext.fs_mount_id = parseStringRef(pos);
+    ext.fs_mount_seen = now;
+  }
+
+  // Memory detail: swap, cache and dirty in MB, swap rates in KB/s, major faults per second
+  pos = findField(fields, "MEMX");
+  if (pos) {
+    uint32_t memory[UI_MEM_COUNT];
+    if (parsePacked(pos, memory, UI_MEM_COUNT) != UI_MEM_COUNT ||
+        memory[UI_MEM_SWAP_USED] > memory[UI_MEM_SWAP_TOTAL]) {
+      Mux_Print(MUX_LOG, "Error: Invalid memory detail");
+      return FRAME_OUT_OF_RANGE;
+    }
+    memcpy(ext.memory, memory, sizeof(memory));
+    ext.memory_seen = now;
+  }
+
+  // Custom metric slots: "<name id>/<value>", or "0" for an empty slot
+  for (int slot = 0; slot < UI_CUSTOM_ROWS; slot++) {
+    char key[3] = { 'M', (char)('0' + slot), '\0' };
+    pos = findField(fields, key);
+    if (!pos) {
+      continue;
+    }
+    const char* slash = strchr(pos, '/');
+    const char* next = strchr(pos, ',');
+    bool hasValue = slash && (!next || slash < next);
+    ext.custom[slot].name_id = hasValue ? parseStringRef(pos) : STRDICT_NONE;
+    ext.custom[slot].value = hasValue ? atof(slash + 1) : 0.0;
+    ext.custom[slot].seen = now;
+  }
+
+  return FRAME_OK;
 }
 
 bool validateChecksum(const char* message) {
@@ -272,7 +659,7 @@ void checkConnectionStatus() {
     if (timeSinceUpdate > DATA_TIMEOUT_MS) {
       metrics.connected = false;
       metrics.disconnect_time = millis();
-      Serial.println("Connection lost - no data received");
+      Mux_Print(MUX_LOG, "Connection lost - no data received");
     }
   }
 }
@@ -282,7 +669,7 @@ void enterPowerSaveMode() {
     return;  // Already in power save mode
   }
   
-  Serial.println("Entering power save mode...");
+  Mux_Print(MUX_LOG, "Entering power save mode...");
   metrics.power_save_mode = true;
   
   // Dim/turn off backlight to save power
@@ -291,10 +678,10 @@ void enterPowerSaveMode() {
   // Reduce CPU frequency if enabled
   if (ENABLE_CPU_FREQ_SCALING) {
     setCpuFrequencyMhz(80);  // Reduce from 160MHz to 80MHz
-    Serial.println("CPU frequency reduced to 80MHz");
+    Mux_Print(MUX_LOG, "CPU frequency reduced to 80MHz");
   }
   
-  Serial.println("Power save mode active");
+  Mux_Print(MUX_LOG, "Power save mode active");
 }
 
 void exitPowerSaveMode() {
@@ -302,7 +689,7 @@ void exitPowerSaveMode() {
     return;  // Not in power save mode
   }
   
-  Serial.println("Exiting power save mode...");
+  Mux_Print(MUX_LOG, "Exiting power save mode...");
   metrics.power_save_mode = false;
   
   // Restore normal backlight
@@ -311,10 +698,10 @@ void exitPowerSaveMode() {
   // Restore CPU frequency if it was scaled
   if (ENABLE_CPU_FREQ_SCALING) {
     setCpuFrequencyMhz(160);  // Restore to default 160MHz
-    Serial.println("CPU frequency restored to 160MHz");
+    Mux_Print(MUX_LOG, "CPU frequency restored to 160MHz");
   }
   
-  Serial.println("Power save mode disabled");
+  Mux_Print(MUX_LOG, "Power save mode disabled");
 }
 
 void managePowerSaving() {
@@ -343,12 +730,286 @@ void updateDisplay() {
   }
   lastUpdate = now;
 
+  updateLabels();
+
+  // Only the visible page is refreshed
+  if (ui_current_page() == UI_PAGE_HISTORY) {
+    // Redraw only when the span changed or its tier gained a bucket
+    static uint32_t drawnSpan = 0;
+    static unsigned long drawnBucket = ~0UL;
+    uint32_t span = ui_history_span_s();
+    unsigned long bucket = historyTicks / History_TierSeconds(History_TierForSpan(span));
+    if (span != drawnSpan || bucket != drawnBucket) {
+      static uint8_t cpuPoints[UI_HISTORY_POINTS];
+      static uint8_t tempPoints[UI_HISTORY_POINTS];
+      History_Read(cpuHistory, span, cpuPoints, UI_HISTORY_POINTS);
+      History_Read(tempHistory, span, tempPoints, UI_HISTORY_POINTS);
+      ui_update_history(cpuPoints, tempPoints);
+      drawnSpan = span;
+      drawnBucket = bucket;
+    }
+    return;
+  }
+
+  if (ui_current_page() == UI_PAGE_STATS) {
+    StatsSummary summary;
+    for (int row = 0; row < UI_STATS_COUNT; row++) {
+      Stats_Summarize(metricStats[row], summary);
+      ui_update_stats((ui_stats_row_t)row, summary.p95, summary.max, summary.avg, summary.session_max);
+    }
+    return;
+  }
+
+  if (ui_current_page() == UI_PAGE_CUSTOM) {
+    updateCustom();
+    return;
+  }
+
+  if (ui_current_page() == UI_PAGE_MEMORY) {
+    updateMemory();
+    return;
+  }
+
+  if (ui_current_page() == UI_PAGE_NUMA) {
+    updateNuma();
+    return;
+  }
+
+  if (ui_current_page() == UI_PAGE_CSTATES) {
+    updateCStates();
+    return;
+  }
+
   // Update UI using enhanced functions with additional parameters
   ui_update_cpu(metrics.cpu_usage, metrics.cpu_freq_ghz);
+  ui_update_cpu_times(ext.cpu_times_seen && now - ext.cpu_times_seen < DATA_TIMEOUT_MS ? ext.cpu_times : NULL);
+  bool throttled = ext.throttle_seen && now - ext.throttle_seen < DATA_TIMEOUT_MS && ext.throttle[0] != 0;
+  ui_update_cpu_throttle(throttled, (uint8_t)ext.throttle[1]);
+  updateAlert();
   ui_update_gpu(metrics.gpu_usage);
   ui_update_ram(metrics.ram_usage, metrics.ram_used_gb, metrics.ram_total_gb);
   ui_update_temp(metrics.temperature, metrics.fan_rpm);
+  ui_set_network_warning(ext.tcp_seen && now - ext.tcp_seen < DATA_TIMEOUT_MS && ext.tcp[0] >= TCP_RETRANS_WARN);
   ui_update_network(metrics.net_download_mbps, metrics.net_upload_mbps);
   ui_update_battery(metrics.battery_percent, metrics.power_watts);
 }
 
+
+// Re-render text labels only when the referenced string ID or its definition changed
+void updateLabels() {
+  static uint16_t drawnHost = 0xFFFF;
+  static uint16_t drawnIfname = 0xFFFF;
+  unsigned long now = millis();
+
+  uint8_t host = now - ext.host_seen < DATA_TIMEOUT_MS ? ext.host_id : STRDICT_NONE;
+  uint8_t ifname = now - ext.ifname_seen < DATA_TIMEOUT_MS ? ext.ifname_id : STRDICT_NONE;
+  uint16_t hostKey = (host << 8) | StrDict_Version(strings, host);
+  uint16_t ifnameKey = (ifname << 8) | StrDict_Version(strings, ifname);
+  if (hostKey == drawnHost && ifnameKey == drawnIfname) {
+    return;
+  }
+  drawnHost = hostKey;
+  drawnIfname = ifnameKey;
+  ui_set_host_label(StrDict_Lookup(strings, host), StrDict_Lookup(strings, ifname));
+}
+
+// Custom metrics page rows; stale or empty slots are blanked
+void updateCustom() {
+  unsigned long now = millis();
+  char value[16];
+
+  for (int slot = 0; slot < UI_CUSTOM_ROWS; slot++) {
+    const CustomMetric& metric = ext.custom[slot];
+    const char* name = NULL;
+    if (metric.name_id != STRDICT_NONE && now - metric.seen < DATA_TIMEOUT_MS) {
+      name = StrDict_Lookup(strings, metric.name_id);
+    }
+    snprintf(value, sizeof(value), "%g", metric.value);
+    ui_update_custom(slot, name, value);
+  }
+}
+
+// Dashboard alert badge for conditions the host flags; hidden when none is active
+void updateAlert() {
+  char text[40];
+  unsigned long now = millis();
+
+  if (ext.irq_seen && now - ext.irq_seen < DATA_TIMEOUT_MS && ext.irq[0]) {
+    const char* source = now - ext.irq_source_seen < DATA_TIMEOUT_MS ?
+                         StrDict_Lookup(strings, ext.irq_source_id) : NULL;
+    snprintf(text, sizeof(text), "%s storm%s%s", (ext.irq[0] & IRQ_STORM_HARD) ? "IRQ" : "Softirq",
+             source ? " " : "", source ? source : "");
+    ui_set_alert(text);
+    return;
+  }
+
+  if (ext.fs_seen && now - ext.fs_seen < DATA_TIMEOUT_MS && ext.fs[1]) {
+    const char* mount = now - ext.fs_mount_seen < DATA_TIMEOUT_MS ? StrDict_Lookup(strings, ext.fs_mount_id) : NULL;
+    snprintf(text, sizeof(text), "Disk %lu%%%s%.16s", (unsigned long)ext.fs[0], mount ? " " : "", mount ? mount : "");
+    ui_set_alert(text);
+    return;
+  }
+  ui_set_alert(NULL);
+}
+
+// Memory detail page; "--" once the host stops sending MEMX or FS
+void updateMemory() {
+  unsigned long now = millis();
+  bool fresh = ext.memory_seen && now - ext.memory_seen < DATA_TIMEOUT_MS;
+  ui_update_memory(fresh ? ext.memory : NULL);
+
+  fresh = ext.fs_seen && now - ext.fs_seen < DATA_TIMEOUT_MS;
+  const char* mount = now - ext.fs_mount_seen < DATA_TIMEOUT_MS ? StrDict_Lookup(strings, ext.fs_mount_id) : NULL;
+  ui_update_disk(fresh ? (int)ext.fs[0] : -1, mount);
+}
+
+// NUMA page; placeholder on single-node hosts or once the host stops sending NUMA
+void updateNuma() {
+  bool fresh = ext.numa_seen && millis() - ext.numa_seen < DATA_TIMEOUT_MS;
+  ui_update_numa(ext.numa, fresh ? ext.numa_nodes : 0);
+}
+
+// C-state page; placeholder when the host has no cpuidle data or stopped sending it
+void updateCStates() {
+  unsigned long now = millis();
+  const char* names[UI_CSTATE_SLOTS] = {};
+  bool fresh = ext.cstates_seen && now - ext.cstates_seen < DATA_TIMEOUT_MS;
+
+  if (now - ext.cstate_names_seen < DATA_TIMEOUT_MS) {
+    for (int slot = 1; slot < ext.cstate_count; slot++) {
+      names[slot] = StrDict_Lookup(strings, ext.cstate_names[slot]);
+    }
+  }
+  ui_update_cstates(ext.cstates, names, fresh ? ext.cstate_count : 0);
+}
+
+void initStats() {
+  // 1-unit buckets: 0-100% for utilisation, 0-127 C for temperature
+  Stats_Init(metricStats[UI_STATS_CPU], 0.0, 1.0);
+  Stats_Init(metricStats[UI_STATS_GPU], 0.0, 1.0);
+  Stats_Init(metricStats[UI_STATS_RAM], 0.0, 1.0);
+  Stats_Init(metricStats[UI_STATS_TEMP], 0.0, 1.0);
+  ui_set_stats_window(STATS_WINDOW_S * (STATS_TICK_MS / 1000) / 60);
+
+  History_Init(cpuHistory);
+  History_Init(tempHistory);
+}
+
+void metricsTick() {
+  static unsigned long lastTick = 0;
+  unsigned long now = millis();
+
+  // Fixed 1 Hz tick: the host may send faster or slower than that, and
+  // skipped frames mean the previous value still holds
+  if (now - lastTick < STATS_TICK_MS) {
+    return;
+  }
+  lastTick = now;
+  historyTicks++;
+
+  // Disconnected ticks are recorded as gaps so the history time axis stays true
+  if (!metrics.connected) {
+    History_PushGap(cpuHistory);
+    History_PushGap(tempHistory);
+    return;
+  }
+
+  History_Push(cpuHistory, metrics.cpu_usage);
+  History_Push(tempHistory, metrics.temperature);
+
+  Stats_Push(metricStats[UI_STATS_CPU], metrics.cpu_usage);
+  Stats_Push(metricStats[UI_STATS_GPU], metrics.gpu_usage);
+  Stats_Push(metricStats[UI_STATS_RAM], metrics.ram_usage);
+  Stats_Push(metricStats[UI_STATS_TEMP], metrics.temperature);
+}
+
+void handleButton() {
+  static int lastState = HIGH;
+  static unsigned long lastChange = 0;
+  static unsigned long pressStart = 0;
+  static bool longPressHandled = false;
+
+  int state = digitalRead(BUTTON_PIN);
+  unsigned long now = millis();
+
+  if (state != lastState && now - lastChange > BUTTON_DEBOUNCE_MS) {
+    lastChange = now;
+    lastState = state;
+
+    if (state == LOW) {
+      pressStart = now;
+      longPressHandled = false;
+    } else if (!longPressHandled) {
+      ui_next_page();
+    }
+  }
+
+  if (state == LOW && !longPressHandled && now - pressStart >= BUTTON_LONG_PRESS_MS) {
+    longPressHandled = true;
+    ui_show_page(ui_current_page() == UI_PAGE_MAIN ? UI_PAGE_STATS : UI_PAGE_MAIN);
+  }
+}
+
+#ifdef UI_PROFILE
+// Objects in a tree, including its root
+static uint32_t countObjects(lv_obj_t* obj) {
+  uint32_t count = 1;
+  for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+    count += countObjects(lv_obj_get_child(obj, i));
+  }
+  return count;
+}
+
+// Cost of one round of dashboard updates in the given digit style
+static void profileUpdates(const char* name, ui_digit_style_t style) {
+  const int rounds = 50;
+  unsigned long updateUs = 0;
+  unsigned long renderUs = 0;
+
+  ui_set_digit_style(style);
+  lv_refr_now(NULL);
+  uint32_t invalidations = ui_metric_row_invalidations();
+  for (int i = 0; i < rounds; i++) {
+    float v = (float)(i * 37 % 100);
+    unsigned long start = micros();
+    ui_update_cpu(v, 3.5);
+    ui_update_gpu(v);
+    ui_update_ram(v, 8.0, 32.0);
+    ui_update_temp(30.0 + v / 2.0, 1200);
+    ui_update_network(v / 10.0, v / 20.0);
+    ui_update_battery(-1, 0.0);
+    updateUs += micros() - start;
+
+    start = micros();
+    lv_refr_now(NULL);
+    renderUs += micros() - start;
+  }
+  Mux_Printf(MUX_LOG, "UI: %s digits, per update round %lu us to update, %lu us to render, %lu invalidated areas",
+                      name, updateUs / rounds, renderUs / rounds,
+                      (unsigned long)((ui_metric_row_invalidations() - invalidations) / rounds));
+}
+
+// One-shot report over serial (build with -DUI_PROFILE): dashboard object
+// count, LVGL heap use, and the update cost with font and segment digits
+void profileUi() {
+  lv_mem_monitor_t mem;
+
+  lv_mem_monitor(&mem);
+  Mux_Printf(MUX_LOG, "UI: dashboard %lu objects (%lu row widgets), all pages %lu objects",
+                      (unsigned long)countObjects(ui_HWMonScreen), (unsigned long)ui_metric_row_count(),
+                      (unsigned long)(countObjects(ui_HWMonScreen) + countObjects(ui_StatsScreen) +
+                                      countObjects(ui_HistoryScreen) + countObjects(ui_MemoryScreen) +
+                                      countObjects(ui_NumaScreen) + countObjects(ui_CStateScreen) +
+                                      countObjects(ui_CustomScreen)));
+  Mux_Printf(MUX_LOG, "UI: LVGL heap %lu of %lu bytes used, %u%% fragmented",
+                      (unsigned long)(mem.total_size - mem.free_size), (unsigned long)mem.total_size, mem.frag_pct);
+
+  profileUpdates("font", UI_DIGITS_FONT);
+  profileUpdates("segment", UI_DIGITS_SEGMENT);
+#ifdef UI_SEGMENT_DIGITS
+  ui_set_digit_style(UI_DIGITS_SEGMENT);
+#else
+  ui_set_digit_style(UI_DIGITS_FONT);
+#endif
+}
+#endif
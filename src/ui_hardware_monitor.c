@@ -1,6 +1,9 @@
 #include "ui_hardware_monitor.h"
+#include "ui_metric_row.h"
+#include "ui_stacked_bar.h"
 #include "ui.h"
 #include <stdio.h>
+#include <string.h>
 
 // Helper: return a color on a green→yellow→red gradient based on a 0–100% value
 // lv_color_mix(c1, c2, ratio): ratio=255 gives c1, ratio=0 gives c2
@@ -34,24 +37,422 @@ static lv_color_t get_pct_color(float pct) {
 // UI Elements
 lv_obj_t * ui_HWMonScreen;
 
-// Dual-label approach: Prefix (white) + Value (dynamic color)
-lv_obj_t * ui_CPULabel_Prefix;
-lv_obj_t * ui_CPULabel_Value;
+// One icon + value row widget per metric
+lv_obj_t * ui_CPURow;
+lv_obj_t * ui_GPURow;
+lv_obj_t * ui_RAMRow;
+lv_obj_t * ui_TempRow;
+lv_obj_t * ui_NetRow;
+lv_obj_t * ui_BatRow;
+lv_obj_t * ui_CPUBar;
+lv_obj_t * ui_AlertLabel;
+
+// Stats page: one table, rows per metric, columns p95/max/avg/peak
+lv_obj_t * ui_StatsScreen;
+lv_obj_t * ui_StatsTable;
+
+// History page: CPU and temperature over a selectable span
+lv_obj_t * ui_HistoryScreen;
+lv_obj_t * ui_HistoryChart;
+lv_obj_t * ui_HistoryLabel_Title;
+lv_obj_t * ui_HistoryLabel_Host;
+
+// Memory detail page: swap, page cache, dirty pages and paging rates
+lv_obj_t * ui_MemoryScreen;
+lv_obj_t * ui_MemoryTable;
+
+// NUMA page: per-node CPU / memory in two columns of four nodes
+lv_obj_t * ui_NumaScreen;
+lv_obj_t * ui_NumaTable;
+
+// C-state page: share of CPU time per idle state in two columns of five
+lv_obj_t * ui_CStateScreen;
+lv_obj_t * ui_CStateTable;
+
+// Custom metrics page: name / value table fed by the host's ingestion socket
+lv_obj_t * ui_CustomScreen;
+lv_obj_t * ui_CustomTable;
+
+static lv_chart_series_t * history_cpu_series;
+static lv_chart_series_t * history_temp_series;
+static lv_coord_t history_cpu_points[UI_HISTORY_POINTS];
+static lv_coord_t history_temp_points[UI_HISTORY_POINTS];
+
+static const uint32_t history_spans_s[] = { 5 * 60, 60 * 60, 24 * 60 * 60 };
+static const char * const history_span_names[] = { "5 min", "1 hour", "24 hours" };
+#define HISTORY_SPAN_COUNT (sizeof(history_spans_s) / sizeof(history_spans_s[0]))
+static uint8_t history_span = 0;
+
+static ui_page_t current_page = UI_PAGE_MAIN;
+static lv_obj_t ** const page_screens[UI_PAGE_COUNT] = {
+    &ui_HWMonScreen,
+    &ui_StatsScreen,
+    &ui_HistoryScreen,
+    &ui_MemoryScreen,
+    &ui_NumaScreen,
+    &ui_CStateScreen,
+    &ui_CustomScreen,
+};
+
+static const char * const stats_row_names[UI_STATS_COUNT] = { "CPU", "GPU", "RAM", "TEMP" };
+
+static void ui_stats_init(void) {
+    ui_StatsScreen = lv_obj_create(NULL);
+    lv_obj_clear_flag(ui_StatsScreen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(ui_StatsScreen, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    ui_StatsTable = lv_table_create(ui_StatsScreen);
+    lv_obj_set_pos(ui_StatsTable, 0, 0);
+    lv_obj_set_size(ui_StatsTable, 320, 172);
+    lv_obj_clear_flag(ui_StatsTable, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_table_set_col_cnt(ui_StatsTable, 5);
+    lv_table_set_row_cnt(ui_StatsTable, UI_STATS_COUNT + 1);
+    lv_table_set_col_width(ui_StatsTable, 0, 68);
+    for (uint16_t col = 1; col < 5; col++) {
+        lv_table_set_col_width(ui_StatsTable, col, 63);
+    }
+
+    lv_obj_set_style_bg_color(ui_StatsTable, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(ui_StatsTable, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(ui_StatsTable, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(ui_StatsTable, lv_color_hex(0x000000), LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(ui_StatsTable, 0, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_top(ui_StatsTable, 6, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_bottom(ui_StatsTable, 6, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_left(ui_StatsTable, 4, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_right(ui_StatsTable, 4, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(ui_StatsTable, lv_color_hex(0xFFFFFF), LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_StatsTable, &lv_font_montserrat_18, LV_PART_ITEMS | LV_STATE_DEFAULT);
+
+    // Header row
+    lv_table_set_cell_value(ui_StatsTable, 0, 0, "");
+    lv_table_set_cell_value(ui_StatsTable, 0, 1, "p95");
+    lv_table_set_cell_value(ui_StatsTable, 0, 2, "max");
+    lv_table_set_cell_value(ui_StatsTable, 0, 3, "avg");
+    lv_table_set_cell_value(ui_StatsTable, 0, 4, "peak");
+    for (uint16_t row = 0; row < UI_STATS_COUNT; row++) {
+        lv_table_set_cell_value(ui_StatsTable, row + 1, 0, stats_row_names[row]);
+        for (uint16_t col = 1; col < 5; col++) {
+            lv_table_set_cell_value(ui_StatsTable, row + 1, col, "--");
+        }
+    }
+}
+
+static void ui_history_set_title(void) {
+    char text[32];
+    snprintf(text, sizeof(text), "CPU / TEMP  %s", history_span_names[history_span]);
+    lv_label_set_text(ui_HistoryLabel_Title, text);
+}
+
+static void ui_history_init(void) {
+    ui_HistoryScreen = lv_obj_create(NULL);
+    lv_obj_clear_flag(ui_HistoryScreen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(ui_HistoryScreen, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    ui_HistoryLabel_Title = lv_label_create(ui_HistoryScreen);
+    lv_obj_set_pos(ui_HistoryLabel_Title, 10, 4);
+    lv_obj_set_style_text_color(ui_HistoryLabel_Title, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_HistoryLabel_Title, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    // Host / interface names, right-aligned in the header band
+    ui_HistoryLabel_Host = lv_label_create(ui_HistoryScreen);
+    lv_obj_set_width(ui_HistoryLabel_Host, 110);
+    lv_obj_set_pos(ui_HistoryLabel_Host, 200, 6);
+    lv_label_set_long_mode(ui_HistoryLabel_Host, LV_LABEL_LONG_DOT);
+    lv_label_set_text(ui_HistoryLabel_Host, "");
+    lv_obj_set_style_text_align(ui_HistoryLabel_Host, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(ui_HistoryLabel_Host, lv_color_hex(0x808080), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_HistoryLabel_Host, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    ui_HistoryChart = lv_chart_create(ui_HistoryScreen);
+    lv_obj_set_pos(ui_HistoryChart, 0, 26);
+    lv_obj_set_size(ui_HistoryChart, 320, 146);
+    lv_obj_clear_flag(ui_HistoryChart, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_chart_set_type(ui_HistoryChart, LV_CHART_TYPE_LINE);
+    lv_chart_set_update_mode(ui_HistoryChart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(ui_HistoryChart, UI_HISTORY_POINTS);
+    // Samples arrive in half units: 0..200 covers 0-100% and 0-100 C
+    lv_chart_set_range(ui_HistoryChart, LV_CHART_AXIS_PRIMARY_Y, 0, 200);
+    lv_chart_set_div_line_count(ui_HistoryChart, 5, 0);
+    lv_obj_set_style_bg_color(ui_HistoryChart, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(ui_HistoryChart, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_line_color(ui_HistoryChart, lv_color_hex(0x303030), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_size(ui_HistoryChart, 0, LV_PART_INDICATOR);   // No point markers
+    lv_obj_set_style_line_width(ui_HistoryChart, 2, LV_PART_ITEMS | LV_STATE_DEFAULT);
+
+    history_cpu_series = lv_chart_add_series(ui_HistoryChart, lv_color_hex(0x00FF00), LV_CHART_AXIS_PRIMARY_Y);
+    history_temp_series = lv_chart_add_series(ui_HistoryChart, lv_color_hex(0xFF6000), LV_CHART_AXIS_PRIMARY_Y);
+    for (uint16_t i = 0; i < UI_HISTORY_POINTS; i++) {
+        history_cpu_points[i] = LV_CHART_POINT_NONE;
+        history_temp_points[i] = LV_CHART_POINT_NONE;
+    }
+    lv_chart_set_ext_y_array(ui_HistoryChart, history_cpu_series, history_cpu_points);
+    lv_chart_set_ext_y_array(ui_HistoryChart, history_temp_series, history_temp_points);
+
+    ui_history_set_title();
+}
+
+// Full-screen two-column name / value table on a new black screen
+static lv_obj_t * ui_create_table_page(lv_obj_t ** screen, uint16_t rows, lv_coord_t name_width) {
+    *screen = lv_obj_create(NULL);
+    lv_obj_clear_flag(*screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(*screen, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    lv_obj_t * table = lv_table_create(*screen);
+    lv_obj_set_pos(table, 0, 0);
+    lv_obj_set_size(table, 320, 172);
+    lv_obj_clear_flag(table, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_table_set_col_cnt(table, 2);
+    lv_table_set_row_cnt(table, rows);
+    lv_table_set_col_width(table, 0, name_width);
+    lv_table_set_col_width(table, 1, 320 - name_width);
+
+    lv_obj_set_style_bg_color(table, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(table, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(table, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_color(table, lv_color_hex(0x000000), LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_border_width(table, 0, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_top(table, 5, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_bottom(table, 5, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_left(table, 8, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_right(table, 8, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(table, lv_color_hex(0xFFFFFF), LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(table, &lv_font_montserrat_16, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    return table;
+}
+
+// Rows of the memory page and the MEMX: values each one shows; the disk row follows them
+static const char * const memory_row_names[] = {
+    "Swap", "Page cache", "Dirty", "Swap in", "Swap out", "Major faults",
+};
+#define MEMORY_ROWS (sizeof(memory_row_names) / sizeof(memory_row_names[0]))
+
+static void ui_memory_init(void) {
+    ui_MemoryTable = ui_create_table_page(&ui_MemoryScreen, MEMORY_ROWS + 1, 150);
+    // Tighter rows so the disk row fits below the memory rows
+    lv_obj_set_style_pad_top(ui_MemoryTable, 3, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_bottom(ui_MemoryTable, 3, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    for (uint16_t row = 0; row < MEMORY_ROWS; row++) {
+        lv_table_set_cell_value(ui_MemoryTable, row, 0, memory_row_names[row]);
+    }
+    lv_table_set_cell_value(ui_MemoryTable, MEMORY_ROWS, 0, "Disk");
+    ui_update_memory(NULL);
+    ui_update_disk(-1, NULL);
+}
+
+#define NUMA_ROWS (UI_NUMA_NODES / 2)
+
+static void ui_numa_init(void) {
+    ui_NumaTable = ui_create_table_page(&ui_NumaScreen, NUMA_ROWS + 1, 160);
+    lv_table_set_cell_value(ui_NumaTable, 0, 0, "Node  CPU / MEM");
+    lv_table_set_cell_value(ui_NumaTable, 0, 1, "Node  CPU / MEM");
+    ui_update_numa(NULL, 0);
+}
+
+#define CSTATE_ROWS (UI_CSTATE_SLOTS / 2)
+
+static void ui_cstate_init(void) {
+    ui_CStateTable = ui_create_table_page(&ui_CStateScreen, CSTATE_ROWS, 160);
+    ui_update_cstates(NULL, NULL, 0);
+}
+
+static void ui_custom_init(void) {
+    ui_CustomTable = ui_create_table_page(&ui_CustomScreen, UI_CUSTOM_ROWS, 200);
+    for (uint16_t row = 0; row < UI_CUSTOM_ROWS; row++) {
+        ui_update_custom(row, NULL, NULL);
+    }
+}
+
+void ui_show_page(ui_page_t page) {
+    if (page >= UI_PAGE_COUNT || page == current_page) {
+        return;
+    }
+    current_page = page;
+    lv_disp_load_scr(*page_screens[page]);
+}
 
-lv_obj_t * ui_GPULabel_Prefix;
-lv_obj_t * ui_GPULabel_Value;
+void ui_next_page(void) {
+    // On the history page a short press steps through the spans first
+    if (current_page == UI_PAGE_HISTORY && history_span + 1 < HISTORY_SPAN_COUNT) {
+        history_span++;
+        ui_history_set_title();
+        return;
+    }
+    if (current_page == UI_PAGE_HISTORY) {
+        history_span = 0;
+        ui_history_set_title();
+    }
+    ui_show_page((ui_page_t)((current_page + 1) % UI_PAGE_COUNT));
+}
+
+ui_page_t ui_current_page(void) {
+    return current_page;
+}
+
+uint32_t ui_history_span_s(void) {
+    return history_spans_s[history_span];
+}
+
+void ui_update_history(const uint8_t *cpu, const uint8_t *temp) {
+    for (uint16_t i = 0; i < UI_HISTORY_POINTS; i++) {
+        history_cpu_points[i] = cpu[i] == UI_HISTORY_GAP ? LV_CHART_POINT_NONE : cpu[i];
+        history_temp_points[i] = temp[i] == UI_HISTORY_GAP ? LV_CHART_POINT_NONE : temp[i];
+    }
+    lv_chart_refresh(ui_HistoryChart);
+}
+
+void ui_set_stats_window(int minutes) {
+    char text[8];
+    snprintf(text, sizeof(text), "%dm", minutes);
+    lv_table_set_cell_value(ui_StatsTable, 0, 0, text);
+}
+
+void ui_update_stats(ui_stats_row_t row, float p95, float max, float avg, float peak) {
+    char text[12];
+    const float values[4] = { p95, max, avg, peak };
+
+    if (row >= UI_STATS_COUNT) {
+        return;
+    }
+    for (uint16_t col = 0; col < 4; col++) {
+        snprintf(text, sizeof(text), "%.0f", values[col]);
+        // Only touch cells whose text changed to keep invalidation small
+        const char * old = lv_table_get_cell_value(ui_StatsTable, row + 1, col + 1);
+        if (old == NULL || strcmp(old, text) != 0) {
+            lv_table_set_cell_value(ui_StatsTable, row + 1, col + 1, text);
+        }
+    }
+}
+
+// Megabytes as "512 MB" or "3.2 GB"
+static void format_mb(char *text, size_t size, uint32_t mb) {
+    if (mb >= 1024) {
+        snprintf(text, size, "%.1f GB", mb / 1024.0f);
+    } else {
+        snprintf(text, size, "%lu MB", (unsigned long)mb);
+    }
+}
 
-lv_obj_t * ui_RAMLabel_Prefix;
-lv_obj_t * ui_RAMLabel_Value;
+void ui_update_memory(const uint32_t *values) {
+    char cells[MEMORY_ROWS][24];
 
-lv_obj_t * ui_TempLabel_Prefix;
-lv_obj_t * ui_TempLabel_Value;
+    if (values == NULL) {
+        for (uint16_t row = 0; row < MEMORY_ROWS; row++) {
+            strcpy(cells[row], "--");
+        }
+    } else {
+        char used[12], total[12];
+        format_mb(used, sizeof(used), values[UI_MEM_SWAP_USED]);
+        format_mb(total, sizeof(total), values[UI_MEM_SWAP_TOTAL]);
+        if (values[UI_MEM_SWAP_TOTAL]) {
+            snprintf(cells[0], sizeof(cells[0]), "%s / %s", used, total);
+        } else {
+            strcpy(cells[0], "off");
+        }
+        format_mb(cells[1], sizeof(cells[1]), values[UI_MEM_CACHE]);
+        format_mb(cells[2], sizeof(cells[2]), values[UI_MEM_DIRTY]);
+        snprintf(cells[3], sizeof(cells[3]), "%lu KB/s", (unsigned long)values[UI_MEM_SWAP_IN]);
+        snprintf(cells[4], sizeof(cells[4]), "%lu KB/s", (unsigned long)values[UI_MEM_SWAP_OUT]);
+        snprintf(cells[5], sizeof(cells[5]), "%lu /s", (unsigned long)values[UI_MEM_MAJOR_FAULTS]);
+    }
 
-lv_obj_t * ui_NetLabel_Prefix;
-lv_obj_t * ui_NetLabel_Value;
+    for (uint16_t row = 0; row < MEMORY_ROWS; row++) {
+        const char * old = lv_table_get_cell_value(ui_MemoryTable, row, 1);
+        if (old == NULL || strcmp(old, cells[row]) != 0) {
+            lv_table_set_cell_value(ui_MemoryTable, row, 1, cells[row]);
+        }
+    }
+}
 
-lv_obj_t * ui_BatIcon;
-lv_obj_t * ui_BatLabel_Value;
+void ui_update_disk(int percent, const char *mount) {
+    char text[24];
+
+    if (percent < 0) {
+        strcpy(text, "--");
+    } else {
+        // Long mount points are cut so the cell stays one line
+        snprintf(text, sizeof(text), "%d%%%s%.13s", percent, mount ? "  " : "", mount ? mount : "");
+    }
+    const char * old = lv_table_get_cell_value(ui_MemoryTable, MEMORY_ROWS, 1);
+    if (old == NULL || strcmp(old, text) != 0) {
+        lv_table_set_cell_value(ui_MemoryTable, MEMORY_ROWS, 1, text);
+    }
+}
+
+void ui_update_numa(const uint8_t *values, uint8_t nodes) {
+    char text[24];
+
+    for (uint8_t node = 0; node < UI_NUMA_NODES; node++) {
+        // Nodes 0-3 fill the left column, 4-7 the right one
+        uint16_t row = node % NUMA_ROWS + 1, col = node / NUMA_ROWS;
+        if (node < nodes) {
+            snprintf(text, sizeof(text), "%u   %u%% / %u%%", node, values[node * 2], values[node * 2 + 1]);
+        } else {
+            snprintf(text, sizeof(text), "%s", node == 0 ? "No NUMA data" : "");
+        }
+        const char * old = lv_table_get_cell_value(ui_NumaTable, row, col);
+        if (old == NULL || strcmp(old, text) != 0) {
+            lv_table_set_cell_value(ui_NumaTable, row, col, text);
+        }
+    }
+}
+
+void ui_update_cstates(const uint16_t *tenths, const char * const *names, uint8_t count) {
+    char text[32];
+
+    for (uint8_t slot = 0; slot < UI_CSTATE_SLOTS; slot++) {
+        // Active and the shallow states fill the left column, deeper states the right one
+        uint16_t row = slot % CSTATE_ROWS, col = slot / CSTATE_ROWS;
+        if (slot >= count) {
+            snprintf(text, sizeof(text), "%s", slot == 0 ? "No C-state data" : "");
+        } else if (slot == 0) {
+            snprintf(text, sizeof(text), "Active  %u.%u%%", tenths[0] / 10, tenths[0] % 10);
+        } else if (names != NULL && names[slot] != NULL) {
+            snprintf(text, sizeof(text), "%.10s  %u.%u%%", names[slot], tenths[slot] / 10, tenths[slot] % 10);
+        } else {
+            snprintf(text, sizeof(text), "State %u  %u.%u%%", slot - 1, tenths[slot] / 10, tenths[slot] % 10);
+        }
+        const char * old = lv_table_get_cell_value(ui_CStateTable, row, col);
+        if (old == NULL || strcmp(old, text) != 0) {
+            lv_table_set_cell_value(ui_CStateTable, row, col, text);
+        }
+    }
+}
+
+void ui_update_custom(uint8_t row, const char *name, const char *value) {
+    // The host fills slots in order, so an empty first row means an empty page
+    const char * blank = row == 0 ? "No custom metrics" : "";
+    const char * cells[2] = { name ? name : blank, name ? value : "" };
+
+    if (row >= UI_CUSTOM_ROWS) {
+        return;
+    }
+    for (uint16_t col = 0; col < 2; col++) {
+        const char * old = lv_table_get_cell_value(ui_CustomTable, row, col);
+        if (old == NULL || strcmp(old, cells[col]) != 0) {
+            lv_table_set_cell_value(ui_CustomTable, row, col, cells[col]);
+        }
+    }
+}
+
+void ui_set_host_label(const char *host, const char *iface) {
+    char text[48];
+    if (host && iface) {
+        snprintf(text, sizeof(text), "%s  %s", host, iface);
+    } else {
+        snprintf(text, sizeof(text), "%s", host ? host : (iface ? iface : ""));
+    }
+    lv_label_set_text(ui_HistoryLabel_Host, text);
+}
+
+static lv_obj_t * ui_create_row(const char * icon, lv_coord_t y, const char * initial) {
+    lv_obj_t * row = ui_metric_row_create(ui_HWMonScreen, &lv_font_montserrat_30, &lv_font_montserrat_32, 50, false);
+    lv_obj_set_pos(row, 10, y);
+    lv_obj_set_width(row, 300);
+    ui_metric_row_set_icon(row, icon, lv_color_hex(0x9400D3));
+    ui_metric_row_set_value(row, initial, lv_color_hex(0xFFFFFF));
+    return row;
+}
 
 void ui_hardware_monitor_init(void) {
     // Create main screen
@@ -59,103 +460,112 @@ void ui_hardware_monitor_init(void) {
     lv_obj_clear_flag(ui_HWMonScreen, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_set_style_bg_color(ui_HWMonScreen, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);  // Black background
 
-    // ========== DUAL-LABEL DISPLAY (6 LINES) ==========
-    // Prefix labels: White text (static)
-    // Value labels: Dynamic colored text
-    // VT323 32pt font, Y=2 start, 28px spacing between lines
-
-    // Line 1: GPU Information (Y=5)
-    ui_GPULabel_Prefix = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_GPULabel_Prefix, 10);
-    lv_obj_set_y(ui_GPULabel_Prefix, 5);
-    lv_label_set_text(ui_GPULabel_Prefix, LV_SYMBOL_IMAGE);
-    lv_obj_set_style_text_color(ui_GPULabel_Prefix, lv_color_hex(0x9400D3), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_GPULabel_Prefix, &lv_font_montserrat_30, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    ui_GPULabel_Value = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_GPULabel_Value, 60);
-    lv_obj_set_y(ui_GPULabel_Value, 5);
-    lv_label_set_text(ui_GPULabel_Value, "0.0%");
-    lv_obj_set_style_text_color(ui_GPULabel_Value, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_GPULabel_Value, &lv_font_montserrat_32, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Line 2: CPU Information (Y=38)
-    ui_CPULabel_Prefix = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_CPULabel_Prefix, 10);
-    lv_obj_set_y(ui_CPULabel_Prefix, 38);
-    lv_label_set_text(ui_CPULabel_Prefix, LV_SYMBOL_SETTINGS);
-    lv_obj_set_style_text_color(ui_CPULabel_Prefix, lv_color_hex(0x9400D3), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_CPULabel_Prefix, &lv_font_montserrat_30, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    ui_CPULabel_Value = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_CPULabel_Value, 60);
-    lv_obj_set_y(ui_CPULabel_Value, 38);
-    lv_label_set_text(ui_CPULabel_Value, "0.0%");
-    lv_obj_set_style_text_color(ui_CPULabel_Value, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_CPULabel_Value, &lv_font_montserrat_32, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Line 3: RAM Information (Y=71)
-    ui_RAMLabel_Prefix = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_RAMLabel_Prefix, 10);
-    lv_obj_set_y(ui_RAMLabel_Prefix, 71);
-    lv_label_set_text(ui_RAMLabel_Prefix, LV_SYMBOL_SD_CARD);
-    lv_obj_set_style_text_color(ui_RAMLabel_Prefix, lv_color_hex(0x9400D3), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_RAMLabel_Prefix, &lv_font_montserrat_30, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    ui_RAMLabel_Value = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_RAMLabel_Value, 60);
-    lv_obj_set_y(ui_RAMLabel_Value, 71);
-    lv_label_set_text(ui_RAMLabel_Value, "0%");
-    lv_obj_set_style_text_color(ui_RAMLabel_Value, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_RAMLabel_Value, &lv_font_montserrat_32, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Line 4: Temperature Information (Y=104)
-    ui_TempLabel_Prefix = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_TempLabel_Prefix, 10);
-    lv_obj_set_y(ui_TempLabel_Prefix, 104);
-    lv_label_set_text(ui_TempLabel_Prefix, LV_SYMBOL_TINT);
-    lv_obj_set_style_text_color(ui_TempLabel_Prefix, lv_color_hex(0x9400D3), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_TempLabel_Prefix, &lv_font_montserrat_30, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    ui_TempLabel_Value = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_TempLabel_Value, 60);
-    lv_obj_set_y(ui_TempLabel_Value, 104);
-    lv_label_set_text(ui_TempLabel_Value, "0°C");
-    lv_obj_set_style_text_color(ui_TempLabel_Value, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_TempLabel_Value, &lv_font_montserrat_32, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Line 5: Network Information (Y=137)
-    ui_NetLabel_Prefix = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_NetLabel_Prefix, 10);
-    lv_obj_set_y(ui_NetLabel_Prefix, 137);
-    lv_label_set_text(ui_NetLabel_Prefix, LV_SYMBOL_WIFI);
-    lv_obj_set_style_text_color(ui_NetLabel_Prefix, lv_color_hex(0x9400D3), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_NetLabel_Prefix, &lv_font_montserrat_30, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    ui_NetLabel_Value = lv_label_create(ui_HWMonScreen);
-    lv_obj_set_x(ui_NetLabel_Value, 60);
-    lv_obj_set_y(ui_NetLabel_Value, 137);
-    lv_label_set_text(ui_NetLabel_Value, "(not available)");
-    lv_obj_set_style_text_color(ui_NetLabel_Value, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_NetLabel_Value, &lv_font_montserrat_32, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    // Line 6: Battery Information (Top Right)
-    ui_BatIcon = lv_label_create(ui_HWMonScreen);
-    lv_obj_align(ui_BatIcon, LV_ALIGN_TOP_RIGHT, -5, 5);
-    lv_label_set_text(ui_BatIcon, LV_SYMBOL_BATTERY_FULL);
-    lv_obj_set_style_text_color(ui_BatIcon, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_BatIcon, &lv_font_montserrat_30, LV_PART_MAIN | LV_STATE_DEFAULT);
-
-    ui_BatLabel_Value = lv_label_create(ui_HWMonScreen);
-    lv_obj_align_to(ui_BatLabel_Value, ui_BatIcon, LV_ALIGN_OUT_LEFT_MID, -5, 0);
-    lv_label_set_text(ui_BatLabel_Value, "");
-    lv_obj_set_style_text_color(ui_BatLabel_Value, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_text_font(ui_BatLabel_Value, &lv_font_montserrat_32, LV_PART_MAIN | LV_STATE_DEFAULT);
+    // ========== ROW WIDGETS (6 LINES) ==========
+    // Each row is a single object drawing a purple icon (static) and a
+    // dynamically colored value 50px to its right
+    // Montserrat 30/32pt, Y=5 start, 33px spacing between lines
+    ui_GPURow = ui_create_row(LV_SYMBOL_IMAGE, 5, "0.0%");        // Line 1: GPU
+    ui_CPURow = ui_create_row(LV_SYMBOL_SETTINGS, 38, "0.0%");    // Line 2: CPU
+    ui_RAMRow = ui_create_row(LV_SYMBOL_SD_CARD, 71, "0%");       // Line 3: RAM
+    ui_TempRow = ui_create_row(LV_SYMBOL_TINT, 104, "0°C");       // Line 4: Temperature
+    ui_NetRow = ui_create_row(LV_SYMBOL_WIFI, 137, "(not available)");  // Line 5: Network
+
+    // CPU time breakdown in the gap below the CPU digits; idle shows as the track
+    static const uint32_t cpu_time_colors[UI_CPU_TIME_COUNT] = {
+        0x00FF00,   // user
+        0x008000,   // nice
+        0xFF6000,   // system
+        0xFFFF00,   // irq
+        0x0080FF,   // iowait
+        0xFF0000,   // steal
+    };
+    lv_color_t colors[UI_CPU_TIME_COUNT];
+    for (int i = 0; i < UI_CPU_TIME_COUNT; i++) {
+        colors[i] = lv_color_hex(cpu_time_colors[i]);
+    }
+    ui_CPUBar = ui_stacked_bar_create(ui_HWMonScreen, UI_CPU_TIME_COUNT, colors, lv_color_hex(0x202020));
+    lv_obj_set_pos(ui_CPUBar, 60, 67);
+    lv_obj_set_size(ui_CPUBar, 250, 3);
+    lv_obj_add_flag(ui_CPUBar, LV_OBJ_FLAG_HIDDEN);
+
+    // Line 6: Battery (top right): icon at the right edge, value to its left
+    ui_BatRow = ui_metric_row_create(ui_HWMonScreen, &lv_font_montserrat_30, &lv_font_montserrat_32, 5, true);
+    lv_obj_set_width(ui_BatRow, 150);
+    lv_obj_align(ui_BatRow, LV_ALIGN_TOP_RIGHT, -5, 5);
+    ui_metric_row_set_icon(ui_BatRow, LV_SYMBOL_BATTERY_FULL, lv_color_hex(0xFFFFFF));
+
+    // Alert badge: opaque, so it covers the battery row while shown
+    ui_AlertLabel = lv_label_create(ui_HWMonScreen);
+    lv_obj_align(ui_AlertLabel, LV_ALIGN_TOP_RIGHT, -5, 5);
+    lv_label_set_text(ui_AlertLabel, "");
+    lv_obj_set_style_bg_color(ui_AlertLabel, lv_color_hex(0xC00000), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_bg_opa(ui_AlertLabel, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_pad_all(ui_AlertLabel, 4, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(ui_AlertLabel, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_AlertLabel, &lv_font_montserrat_16, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_flag(ui_AlertLabel, LV_OBJ_FLAG_HIDDEN);
+
+#ifdef UI_SEGMENT_DIGITS
+    ui_set_digit_style(UI_DIGITS_SEGMENT);
+#endif
+
+    ui_stats_init();
+    ui_history_init();
+    ui_memory_init();
+    ui_numa_init();
+    ui_cstate_init();
+    ui_custom_init();
 
     // Load the screen
     lv_disp_load_scr(ui_HWMonScreen);
 }
 
+void ui_update_cpu_times(const uint16_t *tenths) {
+    if (tenths == NULL) {
+        if (!lv_obj_has_flag(ui_CPUBar, LV_OBJ_FLAG_HIDDEN)) {
+            lv_obj_add_flag(ui_CPUBar, LV_OBJ_FLAG_HIDDEN);
+        }
+        return;
+    }
+    if (lv_obj_has_flag(ui_CPUBar, LV_OBJ_FLAG_HIDDEN)) {
+        lv_obj_clear_flag(ui_CPUBar, LV_OBJ_FLAG_HIDDEN);
+    }
+    ui_stacked_bar_set_values(ui_CPUBar, tenths, 1000);
+}
+
+void ui_update_cpu_throttle(bool throttled, uint8_t limit_pct) {
+    // Only the icon changes, so the row invalidates just the icon rectangle
+    if (!throttled) {
+        ui_metric_row_set_icon(ui_CPURow, LV_SYMBOL_SETTINGS, lv_color_hex(0x9400D3));
+    } else {
+        ui_metric_row_set_icon(ui_CPURow, LV_SYMBOL_WARNING, lv_color_hex(limit_pct >= 25 ? 0xFF0000 : 0xFFA500));
+    }
+}
+
+void ui_set_alert(const char *text) {
+    if (text == NULL) {
+        if (!lv_obj_has_flag(ui_AlertLabel, LV_OBJ_FLAG_HIDDEN)) {
+            lv_obj_add_flag(ui_AlertLabel, LV_OBJ_FLAG_HIDDEN);
+        }
+        return;
+    }
+    if (strcmp(lv_label_get_text(ui_AlertLabel), text) != 0) {
+        lv_label_set_text(ui_AlertLabel, text);
+    }
+    if (lv_obj_has_flag(ui_AlertLabel, LV_OBJ_FLAG_HIDDEN)) {
+        lv_obj_clear_flag(ui_AlertLabel, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+void ui_set_digit_style(ui_digit_style_t style) {
+    lv_obj_t * const rows[] = { ui_CPURow, ui_GPURow, ui_RAMRow, ui_TempRow, ui_NetRow, ui_BatRow };
+    ui_metric_row_mode_t mode = style == UI_DIGITS_SEGMENT ? UI_METRIC_ROW_SEGMENT : UI_METRIC_ROW_FONT;
+
+    for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        ui_metric_row_set_mode(rows[i], mode, &lv_font_montserrat_16);
+    }
+}
+
 void ui_update_cpu(float percent, float freq_ghz) {
     char text[48];
 
@@ -166,11 +576,8 @@ void ui_update_cpu(float percent, float freq_ghz) {
         snprintf(text, sizeof(text), "%.1f%%", percent);
     }
 
-    lv_label_set_text(ui_CPULabel_Value, text);
-
-    // Set color based on CPU percentage (value label only)
-    lv_color_t col = get_pct_color(percent);
-    lv_obj_set_style_text_color(ui_CPULabel_Value, col, LV_PART_MAIN | LV_STATE_DEFAULT);
+    // Color based on CPU percentage (value only)
+    ui_metric_row_set_value(ui_CPURow, text, get_pct_color(percent));
 }
 
 void ui_update_gpu(float percent) {
@@ -183,16 +590,9 @@ void ui_update_gpu(float percent) {
         snprintf(text, sizeof(text), "(not available)");
     }
 
-    lv_label_set_text(ui_GPULabel_Value, text);
-
-    // Set color based on GPU percentage (value label only)
-    if (percent > 0.0) {
-        lv_color_t col = get_pct_color(percent);
-        lv_obj_set_style_text_color(ui_GPULabel_Value, col, LV_PART_MAIN | LV_STATE_DEFAULT);
-    } else {
-        // Gray color for unavailable
-        lv_obj_set_style_text_color(ui_GPULabel_Value, lv_color_make(128, 128, 128), LV_PART_MAIN | LV_STATE_DEFAULT);
-    }
+    // Color based on GPU percentage, gray for unavailable (value only)
+    lv_color_t col = percent > 0.0 ? get_pct_color(percent) : lv_color_make(128, 128, 128);
+    ui_metric_row_set_value(ui_GPURow, text, col);
 }
 
 void ui_update_ram(float percent, float used_gb, float total_gb) {
@@ -203,11 +603,8 @@ void ui_update_ram(float percent, float used_gb, float total_gb) {
     } else {
         snprintf(text, sizeof(text), "%.0f%%", percent);
     }
-    lv_label_set_text(ui_RAMLabel_Value, text);
-
-    // Set color based on RAM percentage (value label only)
-    lv_color_t col = get_pct_color(percent);
-    lv_obj_set_style_text_color(ui_RAMLabel_Value, col, LV_PART_MAIN | LV_STATE_DEFAULT);
+    // Color based on RAM percentage (value only)
+    ui_metric_row_set_value(ui_RAMRow, text, get_pct_color(percent));
 }
 
 void ui_update_temp(float celsius, int fan_rpm) {
@@ -218,14 +615,16 @@ void ui_update_temp(float celsius, int fan_rpm) {
     } else {
         snprintf(text, sizeof(text), "%.0f°C", celsius);
     }
-    lv_label_set_text(ui_TempLabel_Value, text);
-
     // Color: Dynamic based on temperature
     // 30°C (0%) to 90°C (100%)
     float temp_pct = (celsius - 30.0f) / (90.0f - 30.0f) * 100.0f;
-    lv_color_t col = get_pct_color(temp_pct);
-    
-    lv_obj_set_style_text_color(ui_TempLabel_Value, col, LV_PART_MAIN | LV_STATE_DEFAULT);
+    ui_metric_row_set_value(ui_TempRow, text, get_pct_color(temp_pct));
+}
+
+static bool network_warning = false;
+
+void ui_set_network_warning(bool warning) {
+    network_warning = warning;
 }
 
 void ui_update_network(float download_mbps, float upload_mbps) {
@@ -252,8 +651,6 @@ void ui_update_network(float download_mbps, float upload_mbps) {
         snprintf(text, sizeof(text), "%s%.1fM %s%.1fM", down_sym, download_mbps, up_sym, upload_mbps);
     }
     
-    lv_label_set_text(ui_NetLabel_Value, text);
-
     // Set color based on total network speed (value label only)
     float total_speed = download_mbps + upload_mbps;
     lv_color_t col;
@@ -267,7 +664,11 @@ void ui_update_network(float download_mbps, float upload_mbps) {
         // High speed (60-100+ MB/s) - yellow to red, clamped at 100
         col = get_pct_color(total_speed > 100.0f ? 100.0f : total_speed);
     }
-    lv_obj_set_style_text_color(ui_NetLabel_Value, col, LV_PART_MAIN | LV_STATE_DEFAULT);
+    if (network_warning) {
+        // TCP trouble (retransmits) outranks the throughput color
+        col = lv_color_hex(0xFF00FF);
+    }
+    ui_metric_row_set_value(ui_NetRow, text, col);
 }
 
 void ui_update_battery(int percent, float power_watts) {
@@ -278,8 +679,6 @@ void ui_update_battery(int percent, float power_watts) {
     } else {
         snprintf(text, sizeof(text), "--%%");
     }
-    lv_label_set_text(ui_BatLabel_Value, text);
-    lv_obj_align_to(ui_BatLabel_Value, ui_BatIcon, LV_ALIGN_OUT_LEFT_MID, -5, 0);
 
     // Set icon based on percentage
     const char* symbol = LV_SYMBOL_BATTERY_EMPTY;
@@ -287,21 +686,13 @@ void ui_update_battery(int percent, float power_watts) {
     else if (percent > 60) symbol = LV_SYMBOL_BATTERY_3;
     else if (percent > 30) symbol = LV_SYMBOL_BATTERY_2;
     else if (percent > 10) symbol = LV_SYMBOL_BATTERY_1;
-    
-    lv_label_set_text(ui_BatIcon, symbol);
 
-    // Set color based on battery percentage (icon and value)
-    // Reverse gradient: red at low battery
+    // Color for icon and value: reverse gradient (red at low battery), gray when unavailable
+    lv_color_t col = lv_color_make(128, 128, 128);
     if (percent >= 0) {
         // Invert the percentage for battery: 100% = green, 0% = red
-        float inverted_pct = 100.0f - (float)percent;
-        lv_color_t col = get_pct_color(inverted_pct);
-        lv_obj_set_style_text_color(ui_BatIcon, col, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_text_color(ui_BatLabel_Value, col, LV_PART_MAIN | LV_STATE_DEFAULT);
-    } else {
-        // Gray color for unavailable
-        lv_color_t gray = lv_color_make(128, 128, 128);
-        lv_obj_set_style_text_color(ui_BatIcon, gray, LV_PART_MAIN | LV_STATE_DEFAULT);
-        lv_obj_set_style_text_color(ui_BatLabel_Value, gray, LV_PART_MAIN | LV_STATE_DEFAULT);
+        col = get_pct_color(100.0f - (float)percent);
     }
+    ui_metric_row_set_icon(ui_BatRow, symbol, col);
+    ui_metric_row_set_value(ui_BatRow, text, col);
 }
@@ -0,0 +1,417 @@
+#include "ui_metric_row.h"
+#include <string.h>
+
+#define MY_CLASS &ui_metric_row_class
+
+typedef struct {
+    lv_obj_t obj;
+    const lv_font_t * icon_font;
+    const lv_font_t * value_font;
+    const lv_font_t * unit_font;
+    const char * icon;
+    lv_color_t icon_color;
+    lv_color_t value_color;
+    lv_coord_t icon_w;
+    lv_coord_t value_w;
+    lv_coord_t value_x;
+    bool align_right;
+    ui_metric_row_mode_t mode;
+    char value[UI_METRIC_ROW_MAX_LEN];
+} ui_metric_row_t;
+
+// 7-segment geometry: digit cell w x h, stroke t, gap between cells
+typedef struct {
+    lv_coord_t w;
+    lv_coord_t h;
+    lv_coord_t t;
+    lv_coord_t gap;
+    lv_coord_t top;     // Digit top relative to the row
+} segment_metrics_t;
+
+// Segment bits: a (top), b (upper right), c (lower right), d (bottom),
+// e (lower left), f (upper left), g (middle)
+#define SEG_A 0x01
+#define SEG_B 0x02
+#define SEG_C 0x04
+#define SEG_D 0x08
+#define SEG_E 0x10
+#define SEG_F 0x20
+#define SEG_G 0x40
+
+static const uint8_t segment_digits[10] = {
+    SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F,          // 0
+    SEG_B | SEG_C,                                          // 1
+    SEG_A | SEG_B | SEG_D | SEG_E | SEG_G,                  // 2
+    SEG_A | SEG_B | SEG_C | SEG_D | SEG_G,                  // 3
+    SEG_B | SEG_C | SEG_F | SEG_G,                          // 4
+    SEG_A | SEG_C | SEG_D | SEG_F | SEG_G,                  // 5
+    SEG_A | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G,          // 6
+    SEG_A | SEG_B | SEG_C,                                  // 7
+    SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G,  // 8
+    SEG_A | SEG_B | SEG_C | SEG_D | SEG_F | SEG_G,          // 9
+};
+
+static void ui_metric_row_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void ui_metric_row_event(const lv_obj_class_t * class_p, lv_event_t * e);
+
+const lv_obj_class_t ui_metric_row_class = {
+    .constructor_cb = ui_metric_row_constructor,
+    .event_cb = ui_metric_row_event,
+    .instance_size = sizeof(ui_metric_row_t),
+    .base_class = &lv_obj_class,
+};
+
+static uint32_t row_count;
+static uint32_t invalidation_count;
+
+static void segment_metrics(const ui_metric_row_t * row, segment_metrics_t * m) {
+    // Digits span roughly the cap height of the font they replace and sit on its baseline
+    lv_coord_t line_h = lv_font_get_line_height(row->value_font);
+    m->h = line_h * 2 / 3;
+    m->w = m->h / 2 + 1;
+    m->t = LV_MAX(m->h / 9, 2);
+    m->gap = LV_MAX(m->t, 3);
+    m->top = line_h - row->value_font->base_line - m->h;
+}
+
+static bool is_segment_char(uint32_t letter) {
+    return (letter >= '0' && letter <= '9') || letter == '-' || letter == '.' || letter == ':' || letter == ' ';
+}
+
+static lv_coord_t segment_advance(const ui_metric_row_t * row, const segment_metrics_t * m,
+                                  uint32_t letter, uint32_t next) {
+    if ((letter >= '0' && letter <= '9') || letter == '-') {
+        return m->w + m->gap;
+    }
+    if (letter == '.' || letter == ':') {
+        return m->t + m->gap;
+    }
+    if (letter == ' ') {
+        return m->w / 2 + m->gap;
+    }
+    return lv_font_get_glyph_width(row->unit_font, letter, next);
+}
+
+static lv_coord_t segment_text_width(const ui_metric_row_t * row, const char * text) {
+    segment_metrics_t m;
+    uint32_t i = 0;
+    lv_coord_t width = 0;
+
+    segment_metrics(row, &m);
+    while (text[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(text, &i);
+        uint32_t next_i = i;
+        width += segment_advance(row, &m, letter, _lv_txt_encoded_next(text, &next_i));
+    }
+    return width;
+}
+
+static lv_coord_t text_width(const ui_metric_row_t * row, const char * text, const lv_font_t * font) {
+    lv_point_t size;
+    if (font == row->value_font && row->mode == UI_METRIC_ROW_SEGMENT) {
+        return segment_text_width(row, text);
+    }
+    lv_txt_get_size(&size, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    return size.x;
+}
+
+// Absolute area of the icon, or of a value `width` pixels wide
+static void icon_area(const ui_metric_row_t * row, lv_area_t * area) {
+    lv_obj_get_coords((lv_obj_t *)row, area);
+    if (row->align_right) {
+        area->x1 = area->x2 - row->icon_w + 1;
+    } else {
+        area->x2 = area->x1 + row->icon_w - 1;
+    }
+}
+
+static void value_area(const ui_metric_row_t * row, lv_coord_t width, lv_area_t * area) {
+    lv_obj_get_coords((lv_obj_t *)row, area);
+    if (row->align_right) {
+        area->x2 = area->x2 - row->icon_w - row->value_x;
+        area->x1 = area->x2 - width + 1;
+    } else {
+        area->x1 = area->x1 + row->value_x;
+        area->x2 = area->x1 + width - 1;
+    }
+}
+
+static void invalidate(ui_metric_row_t * row, lv_area_t * area) {
+    if (area->x2 < area->x1) {
+        return;
+    }
+    lv_obj_invalidate_area((lv_obj_t *)row, area);
+    invalidation_count++;
+}
+
+/*
+ * Segment mode: invalidate only the runs of character cells that differ
+ * between the old and new text (different character or position), so a
+ * digit tick repaints one cell instead of the whole value.
+ */
+static void invalidate_changed_cells(ui_metric_row_t * row, const char * old_text, lv_coord_t old_w,
+                                     const char * new_text, lv_coord_t new_w) {
+    segment_metrics_t m;
+    lv_area_t old_area;
+    lv_area_t new_area;
+    lv_area_t run;
+    uint32_t oi = 0;
+    uint32_t ni = 0;
+    bool in_run = false;
+
+    segment_metrics(row, &m);
+    value_area(row, old_w, &old_area);
+    value_area(row, new_w, &new_area);
+    lv_coord_t ox = old_area.x1;
+    lv_coord_t nx = new_area.x1;
+    run.y1 = new_area.y1;
+    run.y2 = new_area.y2;
+
+    while (old_text[oi] != '\0' || new_text[ni] != '\0') {
+        uint32_t ol = old_text[oi] != '\0' ? _lv_txt_encoded_next(old_text, &oi) : 0;
+        uint32_t nl = new_text[ni] != '\0' ? _lv_txt_encoded_next(new_text, &ni) : 0;
+        uint32_t onext = oi, nnext = ni;
+        lv_coord_t oadv = ol ? segment_advance(row, &m, ol, _lv_txt_encoded_next(old_text, &onext)) : 0;
+        lv_coord_t nadv = nl ? segment_advance(row, &m, nl, _lv_txt_encoded_next(new_text, &nnext)) : 0;
+
+        if (ol == nl && ox == nx && oadv == nadv) {
+            if (in_run) {
+                invalidate(row, &run);
+                in_run = false;
+            }
+        } else {
+            lv_coord_t x1 = ol && nl ? LV_MIN(ox, nx) : (ol ? ox : nx);
+            lv_coord_t x2 = LV_MAX(ox + oadv, nx + nadv) - 1;
+            if (!in_run) {
+                run.x1 = x1;
+                run.x2 = x2;
+                in_run = true;
+            } else {
+                run.x1 = LV_MIN(run.x1, x1);
+                run.x2 = LV_MAX(run.x2, x2);
+            }
+        }
+        ox += oadv;
+        nx += nadv;
+    }
+    if (in_run) {
+        invalidate(row, &run);
+    }
+}
+
+lv_obj_t * ui_metric_row_create(lv_obj_t * parent, const lv_font_t * icon_font,
+                                const lv_font_t * value_font, lv_coord_t value_x, bool align_right) {
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+
+    ui_metric_row_t * row = (ui_metric_row_t *)obj;
+    row->icon_font = icon_font;
+    row->value_font = value_font;
+    row->unit_font = value_font;
+    row->value_x = value_x;
+    row->align_right = align_right;
+    lv_obj_set_height(obj, LV_MAX(lv_font_get_line_height(icon_font), lv_font_get_line_height(value_font)));
+    return obj;
+}
+
+void ui_metric_row_set_icon(lv_obj_t * obj, const char * icon, lv_color_t color) {
+    ui_metric_row_t * row = (ui_metric_row_t *)obj;
+    lv_area_t area;
+
+    if (row->icon == icon && row->icon_color.full == color.full) {
+        return;
+    }
+
+    lv_coord_t old_w = row->icon_w;
+    lv_coord_t new_w = row->icon == icon ? old_w : text_width(row, icon, row->icon_font);
+
+    // Cover both the old and the new icon
+    row->icon_w = LV_MAX(old_w, new_w);
+    icon_area(row, &area);
+    if (row->align_right && new_w != old_w) {
+        // The value is placed against the icon and shifts with it
+        lv_area_t value;
+        value_area(row, row->value_w, &value);
+        area.x1 = value.x1;
+    }
+    invalidate(row, &area);
+
+    row->icon = icon;
+    row->icon_w = new_w;
+    row->icon_color = color;
+}
+
+void ui_metric_row_set_value(lv_obj_t * obj, const char * text, lv_color_t color) {
+    ui_metric_row_t * row = (ui_metric_row_t *)obj;
+    lv_area_t area;
+
+    bool text_changed = strncmp(row->value, text, sizeof(row->value) - 1) != 0;
+    bool color_changed = row->value_color.full != color.full;
+    if (!text_changed && !color_changed) {
+        return;
+    }
+
+    char old_text[UI_METRIC_ROW_MAX_LEN];
+    lv_coord_t old_w = row->value_w;
+    lv_coord_t width = row->value_w;
+    if (text_changed) {
+        memcpy(old_text, row->value, sizeof(old_text));
+        strncpy(row->value, text, sizeof(row->value) - 1);
+        row->value[sizeof(row->value) - 1] = '\0';
+        width = text_width(row, row->value, row->value_font);
+    }
+    row->value_color = color;
+    row->value_w = width;
+
+    if (row->mode == UI_METRIC_ROW_SEGMENT && !color_changed) {
+        invalidate_changed_cells(row, old_text, old_w, row->value, width);
+        return;
+    }
+
+    // Union of the old and new text extents
+    value_area(row, LV_MAX(width, old_w), &area);
+    invalidate(row, &area);
+}
+
+void ui_metric_row_set_mode(lv_obj_t * obj, ui_metric_row_mode_t mode, const lv_font_t * unit_font) {
+    ui_metric_row_t * row = (ui_metric_row_t *)obj;
+    lv_area_t area;
+
+    if (row->mode == mode && (unit_font == NULL || row->unit_font == unit_font)) {
+        return;
+    }
+    value_area(row, row->value_w, &area);
+    invalidate(row, &area);
+
+    row->mode = mode;
+    if (unit_font != NULL) {
+        row->unit_font = unit_font;
+    }
+    row->value_w = text_width(row, row->value, row->value_font);
+    value_area(row, row->value_w, &area);
+    invalidate(row, &area);
+}
+
+uint32_t ui_metric_row_count(void) {
+    return row_count;
+}
+
+uint32_t ui_metric_row_invalidations(void) {
+    return invalidation_count;
+}
+
+static void ui_metric_row_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj) {
+    LV_UNUSED(class_p);
+    ui_metric_row_t * row = (ui_metric_row_t *)obj;
+
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+    row->icon = "";
+    row->icon_color = lv_color_white();
+    row->value_color = lv_color_white();
+    row->mode = UI_METRIC_ROW_FONT;
+    row->value[0] = '\0';
+    row_count++;
+}
+
+static void fill(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc,
+                 lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2) {
+    lv_area_t area = { x1, y1, x2, y2 };
+    lv_area_t clipped;
+    if (_lv_area_intersect(&clipped, &area, draw_ctx->clip_area)) {
+        lv_draw_rect(draw_ctx, dsc, &area);
+    }
+}
+
+static void draw_segment_char(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc,
+                              const segment_metrics_t * m, lv_coord_t x, lv_coord_t top, uint32_t letter) {
+    const lv_coord_t bottom = top + m->h - 1;
+    const lv_coord_t mid = top + (m->h - m->t) / 2;
+    const lv_coord_t right = x + m->w - 1;
+    uint8_t segments;
+
+    if (letter == '.') {
+        fill(draw_ctx, dsc, x, bottom - m->t + 1, x + m->t - 1, bottom);
+        return;
+    }
+    if (letter == ':') {
+        fill(draw_ctx, dsc, x, top + m->h / 4, x + m->t - 1, top + m->h / 4 + m->t - 1);
+        fill(draw_ctx, dsc, x, bottom - m->h / 4 - m->t + 1, x + m->t - 1, bottom - m->h / 4);
+        return;
+    }
+    segments = letter == '-' ? SEG_G : segment_digits[letter - '0'];
+
+    if (segments & SEG_A) fill(draw_ctx, dsc, x, top, right, top + m->t - 1);
+    if (segments & SEG_G) fill(draw_ctx, dsc, x, mid, right, mid + m->t - 1);
+    if (segments & SEG_D) fill(draw_ctx, dsc, x, bottom - m->t + 1, right, bottom);
+    if (segments & SEG_F) fill(draw_ctx, dsc, x, top, x + m->t - 1, mid + m->t - 1);
+    if (segments & SEG_B) fill(draw_ctx, dsc, right - m->t + 1, top, right, mid + m->t - 1);
+    if (segments & SEG_E) fill(draw_ctx, dsc, x, mid, x + m->t - 1, bottom);
+    if (segments & SEG_C) fill(draw_ctx, dsc, right - m->t + 1, mid, right, bottom);
+}
+
+static void draw_segment_value(ui_metric_row_t * row, lv_draw_ctx_t * draw_ctx, const lv_area_t * area) {
+    segment_metrics_t m;
+    lv_draw_rect_dsc_t rect;
+    lv_draw_label_dsc_t label;
+    uint32_t i = 0;
+    lv_coord_t x = area->x1;
+
+    segment_metrics(row, &m);
+    lv_draw_rect_dsc_init(&rect);
+    rect.bg_color = row->value_color;
+    rect.bg_opa = LV_OPA_COVER;
+    rect.radius = 0;
+    rect.border_width = 0;
+    lv_draw_label_dsc_init(&label);
+    label.font = row->unit_font;
+    label.color = row->value_color;
+
+    const lv_coord_t top = area->y1 + m.top;
+    const lv_coord_t baseline = top + m.h;
+    while (row->value[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(row->value, &i);
+        uint32_t next_i = i;
+        lv_coord_t advance = segment_advance(row, &m, letter, _lv_txt_encoded_next(row->value, &next_i));
+
+        if (x <= draw_ctx->clip_area->x2 && x + advance > draw_ctx->clip_area->x1 && letter != ' ') {
+            if (is_segment_char(letter)) {
+                draw_segment_char(draw_ctx, &rect, &m, x, top, letter);
+            } else {
+                lv_point_t pos = { x, baseline - (lv_font_get_line_height(row->unit_font) - row->unit_font->base_line) };
+                lv_draw_letter(draw_ctx, &label, &pos, letter);
+            }
+        }
+        x += advance;
+    }
+}
+
+static void ui_metric_row_event(const lv_obj_class_t * class_p, lv_event_t * e) {
+    LV_UNUSED(class_p);
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RES_OK) {
+        return;
+    }
+    if (lv_event_get_code(e) != LV_EVENT_DRAW_MAIN) {
+        return;
+    }
+
+    ui_metric_row_t * row = (ui_metric_row_t *)lv_event_get_target(e);
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    lv_draw_label_dsc_t dsc;
+    lv_area_t area;
+
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = row->icon_font;
+    dsc.color = row->icon_color;
+    icon_area(row, &area);
+    lv_draw_label(draw_ctx, &dsc, &area, row->icon, NULL);
+
+    value_area(row, row->value_w, &area);
+    if (row->mode == UI_METRIC_ROW_SEGMENT) {
+        draw_segment_value(row, draw_ctx, &area);
+        return;
+    }
+    dsc.font = row->value_font;
+    dsc.color = row->value_color;
+    lv_draw_label(draw_ctx, &dsc, &area, row->value, NULL);
+}
@@ -0,0 +1,125 @@
+#include "ui_stacked_bar.h"
+#include <string.h>
+
+#define MY_CLASS &ui_stacked_bar_class
+
+typedef struct {
+    lv_obj_t obj;
+    uint8_t count;
+    lv_color_t colors[UI_STACKED_BAR_MAX_SEGMENTS];
+    lv_color_t track;
+    lv_coord_t ends[UI_STACKED_BAR_MAX_SEGMENTS];   // Right edge of each segment, exclusive, relative to x1
+} ui_stacked_bar_t;
+
+static void ui_stacked_bar_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void ui_stacked_bar_event(const lv_obj_class_t * class_p, lv_event_t * e);
+
+const lv_obj_class_t ui_stacked_bar_class = {
+    .constructor_cb = ui_stacked_bar_constructor,
+    .event_cb = ui_stacked_bar_event,
+    .instance_size = sizeof(ui_stacked_bar_t),
+    .base_class = &lv_obj_class,
+};
+
+lv_obj_t * ui_stacked_bar_create(lv_obj_t * parent, uint8_t count, const lv_color_t * colors, lv_color_t track) {
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+
+    ui_stacked_bar_t * bar = (ui_stacked_bar_t *)obj;
+    bar->count = LV_MIN(count, UI_STACKED_BAR_MAX_SEGMENTS);
+    memcpy(bar->colors, colors, bar->count * sizeof(lv_color_t));
+    bar->track = track;
+    return obj;
+}
+
+void ui_stacked_bar_set_values(lv_obj_t * obj, const uint16_t * values, uint16_t total) {
+    ui_stacked_bar_t * bar = (ui_stacked_bar_t *)obj;
+    lv_coord_t width = lv_obj_get_width(obj);
+    lv_area_t coords;
+    lv_area_t dirty;
+    uint32_t sum = 0;
+    bool in_run = false;
+
+    if (total == 0) {
+        return;
+    }
+    lv_obj_get_coords(obj, &coords);
+    dirty.y1 = coords.y1;
+    dirty.y2 = coords.y2;
+
+    // Boundaries come from the running sum, so rounding never accumulates
+    for (uint8_t i = 0; i < bar->count; i++) {
+        sum += values[i];
+        lv_coord_t end = (lv_coord_t)(LV_MIN(sum, total) * width / total);
+        lv_coord_t old = bar->ends[i];
+        bar->ends[i] = end;
+        if (end == old) {
+            continue;
+        }
+
+        // Columns between the old and new boundary change segment; merge overlapping spans
+        lv_coord_t x1 = coords.x1 + LV_MIN(old, end);
+        lv_coord_t x2 = coords.x1 + LV_MAX(old, end) - 1;
+        if (in_run && x1 <= dirty.x2 + 1) {
+            dirty.x2 = LV_MAX(dirty.x2, x2);
+            continue;
+        }
+        if (in_run) {
+            lv_obj_invalidate_area(obj, &dirty);
+        }
+        dirty.x1 = x1;
+        dirty.x2 = x2;
+        in_run = true;
+    }
+    if (in_run) {
+        lv_obj_invalidate_area(obj, &dirty);
+    }
+}
+
+static void ui_stacked_bar_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj) {
+    LV_UNUSED(class_p);
+    ui_stacked_bar_t * bar = (ui_stacked_bar_t *)obj;
+
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+    bar->count = 0;
+    bar->track = lv_color_black();
+    memset(bar->ends, 0, sizeof(bar->ends));
+}
+
+static void ui_stacked_bar_event(const lv_obj_class_t * class_p, lv_event_t * e) {
+    LV_UNUSED(class_p);
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RES_OK) {
+        return;
+    }
+    if (lv_event_get_code(e) != LV_EVENT_DRAW_MAIN) {
+        return;
+    }
+
+    ui_stacked_bar_t * bar = (ui_stacked_bar_t *)lv_event_get_target(e);
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    lv_draw_rect_dsc_t dsc;
+    lv_area_t coords;
+    lv_area_t area;
+    lv_coord_t start = 0;
+
+    lv_obj_get_coords((lv_obj_t *)bar, &coords);
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = 0;
+    dsc.bg_opa = LV_OPA_COVER;
+    area.y1 = coords.y1;
+    area.y2 = coords.y2;
+
+    // Opaque fills only: each segment, then the track after the last one
+    for (uint8_t i = 0; i <= bar->count; i++) {
+        lv_coord_t end = i < bar->count ? bar->ends[i] : lv_area_get_width(&coords);
+        if (end <= start) {
+            continue;
+        }
+        area.x1 = coords.x1 + start;
+        area.x2 = coords.x1 + end - 1;
+        dsc.bg_color = i < bar->count ? bar->colors[i] : bar->track;
+        lv_draw_rect(draw_ctx, &dsc, &area);
+        start = end;
+    }
+}